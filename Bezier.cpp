@@ -0,0 +1,225 @@
+/**********************************************************************************
+// Bezier (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Operaes geomtricas sobre segmentos cbicos de Bzier
+//
+**********************************************************************************/
+
+#include "Bezier.h"
+#include <cmath>
+#include <algorithm>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+XMFLOAT3 Bezier::Point(const Segment& s, float t)
+{
+    float u = 1.0f - t;
+    float alpha = u * u * u;
+    float beta  = 3.0f * t * u * u;
+    float gama  = 3.0f * t * t * u;
+    float teta  = t * t * t;
+
+    return XMFLOAT3(
+        alpha * s.P[0].x + beta * s.P[1].x + gama * s.P[2].x + teta * s.P[3].x,
+        alpha * s.P[0].y + beta * s.P[1].y + gama * s.P[2].y + teta * s.P[3].y,
+        0.0f);
+}
+
+// ------------------------------------------------------------------------------
+
+XMFLOAT3 Bezier::Derivative(const Segment& s, float t)
+{
+    // derivada  uma quadrtica sobre as diferenas dos pontos de controle
+    float u = 1.0f - t;
+    float a = 3.0f * u * u;
+    float b = 6.0f * u * t;
+    float c = 3.0f * t * t;
+
+    return XMFLOAT3(
+        a * (s.P[1].x - s.P[0].x) + b * (s.P[2].x - s.P[1].x) + c * (s.P[3].x - s.P[2].x),
+        a * (s.P[1].y - s.P[0].y) + b * (s.P[2].y - s.P[1].y) + c * (s.P[3].y - s.P[2].y),
+        0.0f);
+}
+
+// ------------------------------------------------------------------------------
+
+XMFLOAT3 Bezier::SecondDerivative(const Segment& s, float t)
+{
+    float u = 1.0f - t;
+
+    return XMFLOAT3(
+        6.0f * (u * (s.P[2].x - 2.0f * s.P[1].x + s.P[0].x) + t * (s.P[3].x - 2.0f * s.P[2].x + s.P[1].x)),
+        6.0f * (u * (s.P[2].y - 2.0f * s.P[1].y + s.P[0].y) + t * (s.P[3].y - 2.0f * s.P[2].y + s.P[1].y)),
+        0.0f);
+}
+
+// ------------------------------------------------------------------------------
+
+void Bezier::Split(const Segment& s, float t, Segment& left, Segment& right)
+{
+    auto lerp = [t](const XMFLOAT3& a, const XMFLOAT3& b)
+    {
+        return XMFLOAT3(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, 0.0f);
+    };
+
+    XMFLOAT3 p01  = lerp(s.P[0], s.P[1]);
+    XMFLOAT3 p12  = lerp(s.P[1], s.P[2]);
+    XMFLOAT3 p23  = lerp(s.P[2], s.P[3]);
+    XMFLOAT3 p012 = lerp(p01, p12);
+    XMFLOAT3 p123 = lerp(p12, p23);
+    XMFLOAT3 mid  = lerp(p012, p123);
+
+    left  = { s.P[0], p01, p012, mid };
+    right = { mid, p123, p23, s.P[3] };
+}
+
+// ------------------------------------------------------------------------------
+
+Segment Bezier::Sub(const Segment& s, float t0, float t1)
+{
+    if (t0 > t1)
+    {
+        Segment r = Sub(s, t1, t0);
+        return { r.P[3], r.P[2], r.P[1], r.P[0] };
+    }
+
+    Segment left, right, mid;
+    Split(s, t1, left, right);
+
+    if (t1 <= 0.0f)
+        return { left.P[0], left.P[0], left.P[0], left.P[0] };
+
+    Split(left, t0 / t1, right, mid);
+    return mid;
+}
+
+// ------------------------------------------------------------------------------
+
+Box Bezier::Hull(const Segment& s)
+{
+    Box box = { s.P[0].x, s.P[0].y, s.P[0].x, s.P[0].y };
+
+    for (int i = 1; i < 4; ++i)
+    {
+        box.minX = min(box.minX, s.P[i].x);
+        box.minY = min(box.minY, s.P[i].y);
+        box.maxX = max(box.maxX, s.P[i].x);
+        box.maxY = max(box.maxY, s.P[i].y);
+    }
+
+    return box;
+}
+
+// ------------------------------------------------------------------------------
+
+Box Bezier::Bounds(const Segment& s)
+{
+    Box box = {
+        min(s.P[0].x, s.P[3].x), min(s.P[0].y, s.P[3].y),
+        max(s.P[0].x, s.P[3].x), max(s.P[0].y, s.P[3].y) };
+
+    // pontos de apoio dentro da caixa das ncoras no criam extremos
+    Box hull = Hull(s);
+    if (Contains(box, hull))
+        return box;
+
+    // em cada eixo a derivada  a t + b t + c; suas razes em (0,1) so extremos
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        float p0 = axis == 0 ? s.P[0].x : s.P[0].y;
+        float p1 = axis == 0 ? s.P[1].x : s.P[1].y;
+        float p2 = axis == 0 ? s.P[2].x : s.P[2].y;
+        float p3 = axis == 0 ? s.P[3].x : s.P[3].y;
+
+        float a = 3.0f * (-p0 + 3.0f * p1 - 3.0f * p2 + p3);
+        float b = 6.0f * (p0 - 2.0f * p1 + p2);
+        float c = 3.0f * (p1 - p0);
+
+        float roots[2];
+        int n = 0;
+
+        if (fabs(a) < 1e-12f)
+        {
+            if (fabs(b) > 1e-12f)
+                roots[n++] = -c / b;
+        }
+        else
+        {
+            float disc = b * b - 4.0f * a * c;
+            if (disc >= 0.0f)
+            {
+                float q = -0.5f * (b + (b >= 0.0f ? sqrt(disc) : -sqrt(disc)));
+                roots[n++] = q / a;
+                if (q != 0.0f)
+                    roots[n++] = c / q;
+            }
+        }
+
+        float& lo = axis == 0 ? box.minX : box.minY;
+        float& hi = axis == 0 ? box.maxX : box.maxY;
+
+        for (int k = 0; k < n; ++k)
+        {
+            float t = roots[k];
+            if (t <= 0.0f || t >= 1.0f)
+                continue;
+
+            float u = 1.0f - t;
+            float v = u * u * u * p0 + 3.0f * t * u * u * p1 + 3.0f * t * t * u * p2 + t * t * t * p3;
+            lo = min(lo, v);
+            hi = max(hi, v);
+        }
+    }
+
+    return box;
+}
+
+// ------------------------------------------------------------------------------
+
+float Bezier::Flatness(const Segment& s)
+{
+    float dx = s.P[3].x - s.P[0].x;
+    float dy = s.P[3].y - s.P[0].y;
+    float len = sqrt(dx * dx + dy * dy);
+
+    // corda degenerada: usa a distncia at a ncora
+    if (len < 1e-12f)
+    {
+        float d1 = hypot(s.P[1].x - s.P[0].x, s.P[1].y - s.P[0].y);
+        float d2 = hypot(s.P[2].x - s.P[0].x, s.P[2].y - s.P[0].y);
+        return max(d1, d2);
+    }
+
+    float d1 = fabs((s.P[1].x - s.P[0].x) * dy - (s.P[1].y - s.P[0].y) * dx) / len;
+    float d2 = fabs((s.P[2].x - s.P[0].x) * dy - (s.P[2].y - s.P[0].y) * dx) / len;
+    return max(d1, d2);
+}
+
+// ------------------------------------------------------------------------------
+
+Box Bezier::Merge(const Box& a, const Box& b)
+{
+    return { min(a.minX, b.minX), min(a.minY, b.minY), max(a.maxX, b.maxX), max(a.maxY, b.maxY) };
+}
+
+// ------------------------------------------------------------------------------
+
+bool Bezier::Overlap(const Box& a, const Box& b)
+{
+    return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY && b.minY <= a.maxY;
+}
+
+// ------------------------------------------------------------------------------
+
+bool Bezier::Contains(const Box& outer, const Box& inner)
+{
+    return outer.minX <= inner.minX && outer.minY <= inner.minY
+        && outer.maxX >= inner.maxX && outer.maxY >= inner.maxY;
+}
+
+// ------------------------------------------------------------------------------
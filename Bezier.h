@@ -0,0 +1,68 @@
+/**********************************************************************************
+// Bezier (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Operaes geomtricas sobre segmentos cbicos de Bzier
+//
+**********************************************************************************/
+
+#ifndef _BEZIER_H_
+#define _BEZIER_H_
+
+#include "DXUT.h"
+
+// ------------------------------------------------------------------------------
+
+// Segmento cbico: P[0] e P[3] so as ncoras, P[1] e P[2] os pontos de apoio
+struct Segment
+{
+    XMFLOAT3 P[4];
+};
+
+// Caixa alinhada aos eixos no plano XY
+struct Box
+{
+    float minX, minY;
+    float maxX, maxY;
+};
+
+// ------------------------------------------------------------------------------
+
+namespace Bezier
+{
+    // ponto da curva no parmetro t
+    XMFLOAT3 Point(const Segment& s, float t);
+
+    // primeira derivada no parmetro t
+    XMFLOAT3 Derivative(const Segment& s, float t);
+
+    // segunda derivada no parmetro t
+    XMFLOAT3 SecondDerivative(const Segment& s, float t);
+
+    // divide o segmento em t (de Casteljau)
+    void Split(const Segment& s, float t, Segment& left, Segment& right);
+
+    // trecho da curva entre t0 e t1 (t0 > t1 inverte o sentido)
+    Segment Sub(const Segment& s, float t0, float t1);
+
+    // caixa do polgono de controle (contm a curva inteira)
+    Box Hull(const Segment& s);
+
+    // menor caixa que contm a curva: extremos nas ncoras e nas razes da derivada
+    Box Bounds(const Segment& s);
+
+    // distncia mxima dos pontos de apoio at a corda P0-P3
+    float Flatness(const Segment& s);
+
+    // operaes sobre caixas
+    Box  Merge(const Box& a, const Box& b);
+    bool Overlap(const Box& a, const Box& b);
+    bool Contains(const Box& outer, const Box& inner);
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
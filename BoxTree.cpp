@@ -0,0 +1,346 @@
+/**********************************************************************************
+// BoxTree (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Hierarquia de caixas (BVH) para consultas de sobreposio
+//
+**********************************************************************************/
+
+#include "BoxTree.h"
+#include <algorithm>
+#include <cfloat>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    // caixa de um item removido: no sobrepe nada
+    const Box Removed = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    // quanto o semipermetro de a cresce para incluir b
+    float Growth(const Box& a, const Box& b)
+    {
+        Box m = Bezier::Merge(a, b);
+        return (m.maxX - m.minX + m.maxY - m.minY) - (a.maxX - a.minX + a.maxY - a.minY);
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+void BoxTree::Build(const Box* boxes, uint count)
+{
+    Clear();
+
+    if (count == 0)
+        return;
+
+    items.resize(count);
+    slot.resize(count);
+    for (uint i = 0; i < count; ++i)
+        items[i] = { boxes[i], i };
+
+    live = count;
+    nodes.reserve(2 * (count / LeafSize + 1));
+    nodes.push_back({ boxes[0], 0, count });
+    Split(0, 0);
+}
+
+// ------------------------------------------------------------------------------
+
+void BoxTree::Clear()
+{
+    nodes.clear();
+    items.clear();
+    slot.clear();
+    live = 0;
+    wastedItems = 0;
+    wastedNodes = 0;
+}
+
+// ------------------------------------------------------------------------------
+
+// Subdivide o n pela mediana dos centros no eixo de maior extenso
+void BoxTree::Split(uint node, uint depth)
+{
+    uint first = nodes[node].first;
+    uint count = nodes[node].count;
+
+    auto center = [](const Box& b) { return XMFLOAT2(0.5f * (b.minX + b.maxX), 0.5f * (b.minY + b.maxY)); };
+
+    XMFLOAT2 c = center(items[first].box);
+    Box box = items[first].box;
+    Box span = { c.x, c.y, c.x, c.y };
+
+    for (uint i = first + 1; i < first + count; ++i)
+    {
+        c = center(items[i].box);
+        box = Bezier::Merge(box, items[i].box);
+        span = Bezier::Merge(span, { c.x, c.y, c.x, c.y });
+    }
+
+    nodes[node].box = box;
+
+    if (count <= LeafSize || depth + 1 >= MaxDepth)
+    {
+        for (uint i = first; i < first + count; ++i)
+            slot[items[i].index] = i;
+        return;
+    }
+
+    bool axisX = (span.maxX - span.minX) >= (span.maxY - span.minY);
+    uint half = count / 2;
+
+    nth_element(items.begin() + first, items.begin() + first + half, items.begin() + first + count,
+        [&](const Entry& a, const Entry& b) { return axisX ? center(a.box).x < center(b.box).x : center(a.box).y < center(b.box).y; });
+
+    uint child = uint(nodes.size());
+    nodes.push_back({ box, first, half });
+    nodes.push_back({ box, first + half, count - half });
+
+    nodes[node].first = child;
+    nodes[node].count = 0;
+
+    Split(child, depth + 1);
+    Split(child + 1, depth + 1);
+}
+
+// ------------------------------------------------------------------------------
+
+uint BoxTree::Limit(uint size)
+{
+    // uma rvore equilibrada tem cerca de log2(size / LeafSize) nveis;
+    // o dobro disso  tolerado antes de refazer o ramo
+    uint levels = 0;
+    while ((LeafSize << levels) < size)
+        ++levels;
+
+    return 2 * levels + 2;
+}
+
+// ------------------------------------------------------------------------------
+
+// Quantidade de itens presentes no ramo
+uint BoxTree::Count(uint node) const
+{
+    uint stack[MaxDepth * 2];
+    uint top = 0;
+    uint total = 0;
+    stack[top++] = node;
+
+    while (top > 0)
+    {
+        const Node& n = nodes[stack[--top]];
+
+        if (n.count > 0)
+        {
+            for (uint i = n.first; i < n.first + n.count; ++i)
+                total += slot[items[i].index] == i;
+        }
+        else
+        {
+            stack[top++] = n.first + 1;
+            stack[top++] = n.first;
+        }
+    }
+
+    return total;
+}
+
+// ------------------------------------------------------------------------------
+
+// Copia os itens presentes no ramo; slots recebe as entradas ocupadas
+// pelas folhas (presentes ou no) e descendants o nmero de ns abaixo
+void BoxTree::Gather(uint node, vector<Entry>& out, uint& slots, uint& descendants) const
+{
+    uint stack[MaxDepth * 2];
+    uint top = 0;
+    stack[top++] = node;
+    slots = 0;
+    descendants = 0;
+
+    while (top > 0)
+    {
+        const Node& n = nodes[stack[--top]];
+
+        if (n.count > 0)
+        {
+            slots += n.count;
+            for (uint i = n.first; i < n.first + n.count; ++i)
+                if (slot[items[i].index] == i)
+                    out.push_back(items[i]);
+        }
+        else
+        {
+            descendants += 2;
+            stack[top++] = n.first + 1;
+            stack[top++] = n.first;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+// Refaz o ramo equilibrado; os itens vo para o fim de items e os ns
+// antigos abaixo dele ficam sem uso at a prxima compactao
+void BoxTree::Rebuild(uint node, uint depth)
+{
+    vector<Entry> entries;
+    uint slots, descendants;
+    Gather(node, entries, slots, descendants);
+
+    wastedItems += slots;
+    wastedNodes += descendants;
+
+    uint first = uint(items.size());
+    items.insert(items.end(), entries.begin(), entries.end());
+
+    nodes[node].first = first;
+    nodes[node].count = uint(entries.size());
+    Split(node, depth);
+
+    if (wastedItems > items.size() / 2 || wastedNodes > nodes.size() / 2)
+        Compact();
+}
+
+// ------------------------------------------------------------------------------
+
+// Reconstri a rvore inteira s com os itens presentes
+void BoxTree::Compact()
+{
+    vector<Entry> entries;
+    entries.reserve(live);
+
+    uint slots, descendants;
+    Gather(0, entries, slots, descendants);
+
+    nodes.clear();
+    items.swap(entries);
+    wastedItems = 0;
+    wastedNodes = 0;
+
+    nodes.push_back({ items[0].box, 0, uint(items.size()) });
+    Split(0, 0);
+}
+
+// ------------------------------------------------------------------------------
+
+void BoxTree::Insert(uint index, const Box& box)
+{
+    if (index >= slot.size())
+        slot.resize(index + 1, uint(Absent));
+    else if (slot[index] != Absent)
+        return;
+
+    Entry entry = { box, index };
+
+    if (live == 0)
+    {
+        nodes.assign(1, { box, 0, 1 });
+        items.assign(1, entry);
+        slot[index] = 0;
+        live = 1;
+        wastedItems = 0;
+        wastedNodes = 0;
+        return;
+    }
+
+    // desce pelo filho que menos cresce, ajustando as caixas no caminho
+    uint path[MaxDepth];
+    uint depth = 0;
+    uint n = 0;
+
+    while (nodes[n].count == 0)
+    {
+        path[depth++] = n;
+        nodes[n].box = Bezier::Merge(nodes[n].box, box);
+
+        uint c = nodes[n].first;
+        n = Growth(nodes[c].box, box) <= Growth(nodes[c + 1].box, box) ? c : c + 1;
+    }
+
+    nodes[n].box = Bezier::Merge(nodes[n].box, box);
+    ++live;
+
+    // folha no fim de items com espao: o item entra direto
+    if (nodes[n].first + nodes[n].count == items.size() && nodes[n].count < LeafSize)
+    {
+        slot[index] = uint(items.size());
+        items.push_back(entry);
+        ++nodes[n].count;
+        return;
+    }
+
+    // seno a folha  copiada para o fim com o item novo e dividida se encher
+    uint first = uint(items.size());
+    uint old = nodes[n].first;
+    uint oldCount = nodes[n].count;
+
+    for (uint i = old; i < old + oldCount; ++i)
+    {
+        Entry e = items[i];
+        if (slot[e.index] == i)
+            items.push_back(e);
+    }
+    items.push_back(entry);
+    wastedItems += oldCount;
+
+    nodes[n].first = first;
+    nodes[n].count = uint(items.size()) - first;
+    Split(n, depth);
+
+    // ramo fundo demais para o seu tamanho: o ancestral mais baixo que
+    // viola o limite  refeito (os de cima continuam equilibrados)
+    uint height = depth + (nodes[n].count == 0 ? 1 : 0);
+
+    if (height > Limit(live))
+    {
+        uint size = Count(n);
+
+        for (uint j = depth; j-- > 0;)
+        {
+            uint a = path[j];
+            uint c = nodes[a].first;
+            uint sibling = (c == n) ? c + 1 : c;
+
+            size += Count(sibling);
+
+            if (height - j > Limit(size) || j == 0)
+            {
+                Rebuild(a, j);
+                return;
+            }
+
+            n = a;
+        }
+    }
+
+    if (wastedItems > items.size() / 2 || wastedNodes > nodes.size() / 2)
+        Compact();
+}
+
+// ------------------------------------------------------------------------------
+
+void BoxTree::Remove(uint index)
+{
+    if (index >= slot.size() || slot[index] == Absent)
+        return;
+
+    items[slot[index]].box = Removed;
+    slot[index] = Absent;
+    ++wastedItems;
+
+    if (--live == 0)
+    {
+        Clear();
+        return;
+    }
+
+    if (wastedItems > items.size() / 2)
+        Compact();
+}
+
+// ------------------------------------------------------------------------------
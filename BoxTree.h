@@ -0,0 +1,181 @@
+/**********************************************************************************
+// BoxTree (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Hierarquia de caixas (BVH) para consultas de sobreposio
+//
+**********************************************************************************/
+
+#ifndef _BOXTREE_H_
+#define _BOXTREE_H_
+
+#include "Bezier.h"
+#include <vector>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Alm da construo completa, aceita inseres e remoes sem reconstruir
+// tudo: um item novo desce at a folha que menos cresce, e quando um ramo
+// fica fundo demais para o seu tamanho s aquele ramo  refeito. Espaos
+// liberados so recuperados numa reconstruo quando passam da metade.
+class BoxTree
+{
+private:
+    // n interno: count = 0 e filhos em first e first + 1
+    // folha: itens items[first .. first + count - 1]
+    struct Node
+    {
+        Box  box;
+        uint first;
+        uint count;
+    };
+
+    // caixa de um item e seu ndice original
+    struct Entry
+    {
+        Box  box;
+        uint index;
+    };
+
+    static const uint LeafSize = 4;
+    static const uint MaxDepth = 64;
+    static const uint Absent = ~0u;
+
+    vector<Node>  nodes;
+    vector<Entry> items;        // agrupados por folha
+    vector<uint>  slot;         // posio de cada ndice em items (Absent se no est)
+    uint live = 0;              // itens presentes
+    uint wastedItems = 0;       // entradas de items fora de uso
+    uint wastedNodes = 0;       // ns que ficaram fora da rvore
+
+    void Split(uint node, uint depth);
+    uint Count(uint node) const;
+    void Gather(uint node, vector<Entry>& out, uint& slots, uint& descendants) const;
+    void Rebuild(uint node, uint depth);
+    void Compact();
+
+    // altura aceitvel para um ramo com size itens
+    static uint Limit(uint size);
+
+public:
+    void Build(const Box* boxes, uint count);
+    void Clear();
+
+    // acrescenta o item index com a caixa box (index no pode estar na rvore)
+    void Insert(uint index, const Box& box);
+
+    // retira o item index; as caixas dos ns acima no encolhem
+    void Remove(uint index);
+
+    bool Empty() const { return live == 0; }
+    uint Size() const { return live; }
+    const Box& Bounds() const { return nodes[0].box; }
+
+    // chama visit(i) para cada item cuja caixa sobrepe region; como region
+    //  uma referncia, o visitante pode encolh-la durante a busca
+    template<class Visit>
+    void Query(const Box& region, Visit visit) const;
+
+    // Busca guiada por uma forma que pode ser subdividida (uma curva):
+    // bound(part) d a caixa de uma parte e split(part, a, b) a divide em
+    // duas, retornando false se ela no deve mais ser dividida. A parte 
+    // dividida enquanto for maior que o n visitado, de modo que s os
+    // itens perto da forma, e no de toda a sua caixa, so visitados.
+    // Um item pode ser visitado por mais de uma parte.
+    template<class Part, class Bound, class Divide, class Visit>
+    void Query(const Part& whole, Bound bound, Divide split, Visit visit) const;
+};
+
+// ------------------------------------------------------------------------------
+
+template<class Visit>
+void BoxTree::Query(const Box& region, Visit visit) const
+{
+    if (live == 0)
+        return;
+
+    uint stack[MaxDepth * 2];
+    uint top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const Node& node = nodes[stack[--top]];
+
+        if (!Bezier::Overlap(node.box, region))
+            continue;
+
+        if (node.count > 0)
+        {
+            for (uint i = node.first; i < node.first + node.count; ++i)
+                if (Bezier::Overlap(items[i].box, region))
+                    visit(items[i].index);
+        }
+        else
+        {
+            stack[top++] = node.first + 1;
+            stack[top++] = node.first;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Part, class Bound, class Divide, class Visit>
+void BoxTree::Query(const Part& whole, Bound bound, Divide split, Visit visit) const
+{
+    if (live == 0)
+        return;
+
+    struct Pending
+    {
+        uint node;
+        Part part;
+    };
+
+    auto extent = [](const Box& b) { return (b.maxX - b.minX) > (b.maxY - b.minY) ? b.maxX - b.minX : b.maxY - b.minY; };
+
+    vector<Pending> stack;
+    stack.push_back({ 0, whole });
+
+    while (!stack.empty())
+    {
+        Pending p = stack.back();
+        stack.pop_back();
+
+        const Node& node = nodes[p.node];
+        Box box = bound(p.part);
+
+        if (!Bezier::Overlap(node.box, box))
+            continue;
+
+        // parte maior que o n: divide a parte e testa as metades no mesmo n
+        Part a, b;
+        if (extent(box) > extent(node.box) && split(p.part, a, b))
+        {
+            stack.push_back({ p.node, b });
+            stack.push_back({ p.node, a });
+            continue;
+        }
+
+        if (node.count > 0)
+        {
+            for (uint i = node.first; i < node.first + node.count; ++i)
+                if (Bezier::Overlap(items[i].box, box))
+                    visit(items[i].index);
+        }
+        else
+        {
+            stack.push_back({ node.first + 1, p.part });
+            stack.push_back({ node.first, p.part });
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,455 @@
+/**********************************************************************************
+// CurveFit (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Ajuste de cadeias de cbicas a traos  mo livre (Schneider)
+//
+**********************************************************************************/
+
+#include "CurveFit.h"
+#include <cmath>
+#include <algorithm>
+#include <cfloat>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    const int MaxIterations = 4;        // reparametrizaes antes de dividir
+    const int SmoothIterations = 10;    // reparametrizaes da cadeia C1 antes de dividir
+
+    XMFLOAT3 Add(const XMFLOAT3& a, const XMFLOAT3& b)  { return XMFLOAT3(a.x + b.x, a.y + b.y, 0.0f); }
+    XMFLOAT3 Sub(const XMFLOAT3& a, const XMFLOAT3& b)  { return XMFLOAT3(a.x - b.x, a.y - b.y, 0.0f); }
+    XMFLOAT3 Scale(const XMFLOAT3& a, float s)          { return XMFLOAT3(a.x * s, a.y * s, 0.0f); }
+    float    Dot(const XMFLOAT3& a, const XMFLOAT3& b)  { return a.x * b.x + a.y * b.y; }
+    float    Length(const XMFLOAT3& a)                  { return sqrt(Dot(a, a)); }
+
+    XMFLOAT3 Normalize(const XMFLOAT3& a)
+    {
+        float len = Length(a);
+        return len > 0.0f ? Scale(a, 1.0f / len) : XMFLOAT3(0.0f, 0.0f, 0.0f);
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Um passo de Newton por ponto aproxima cada parmetro do ponto mais prximo
+    void Reparameterize(const vector<XMFLOAT3>& d, uint first, uint last, const Segment& s, vector<float>& u)
+    {
+        for (uint i = first; i <= last; ++i)
+        {
+            float& t = u[i - first];
+            XMFLOAT3 q  = Sub(Bezier::Point(s, t), d[i]);
+            XMFLOAT3 d1 = Bezier::Derivative(s, t);
+            XMFLOAT3 d2 = Bezier::SecondDerivative(s, t);
+
+            float num = Dot(q, d1);
+            float den = Dot(d1, d1) + Dot(q, d2);
+            if (den != 0.0f)
+                t = min(1.0f, max(0.0f, t - num / den));
+        }
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Trecho ajustado: segmento, pontos que ele cobre, seus parmetros
+    // e as tangentes unitrias nas pontas
+    struct Fitted
+    {
+        Segment s;
+        uint first, last;
+        vector<float> u;
+        XMFLOAT3 tHat1, tHat2;
+    };
+
+    class Fitter
+    {
+    private:
+        const vector<XMFLOAT3>& d;
+        float error;
+        vector<Fitted>& out;
+
+    public:
+        Fitter(const vector<XMFLOAT3>& points, float tolerance, vector<Fitted>& fitted)
+            : d(points), error(tolerance), out(fitted) {}
+
+        // ---------------------------------------------------------------------
+
+        // Parametrizao pelo comprimento acumulado da poligonal
+        void ChordLength(uint first, uint last, vector<float>& u) const
+        {
+            u.resize(last - first + 1);
+            u[0] = 0.0f;
+
+            for (uint i = first + 1; i <= last; ++i)
+                u[i - first] = u[i - first - 1] + Length(Sub(d[i], d[i - 1]));
+
+            float total = u.back();
+            for (float& v : u)
+                v = total > 0.0f ? v / total : 0.0f;
+        }
+
+        // ---------------------------------------------------------------------
+
+        // Mnimos quadrados para o tamanho das alas, com tangentes fixas
+        Segment Generate(uint first, uint last, const vector<float>& u,
+                         const XMFLOAT3& tHat1, const XMFLOAT3& tHat2) const
+        {
+            float c00 = 0, c01 = 0, c11 = 0, x0 = 0, x1 = 0;
+            const XMFLOAT3& p0 = d[first];
+            const XMFLOAT3& p3 = d[last];
+
+            for (uint i = first; i <= last; ++i)
+            {
+                float t = u[i - first];
+                float s = 1.0f - t;
+                float b0 = s * s * s, b1 = 3 * t * s * s, b2 = 3 * t * t * s, b3 = t * t * t;
+
+                XMFLOAT3 a0 = Scale(tHat1, b1);
+                XMFLOAT3 a1 = Scale(tHat2, b2);
+
+                c00 += Dot(a0, a0);
+                c01 += Dot(a0, a1);
+                c11 += Dot(a1, a1);
+
+                XMFLOAT3 tmp = Sub(d[i], Add(Scale(p0, b0 + b1), Scale(p3, b2 + b3)));
+                x0 += Dot(a0, tmp);
+                x1 += Dot(a1, tmp);
+            }
+
+            float det = c00 * c11 - c01 * c01;
+            float alphaL = det != 0.0f ? (x0 * c11 - x1 * c01) / det : 0.0f;
+            float alphaR = det != 0.0f ? (c00 * x1 - c01 * x0) / det : 0.0f;
+
+            // alas degeneradas ou invertidas: usa um tero da corda
+            float chord = Length(Sub(p3, p0));
+            float eps = 1e-6f * chord;
+            if (alphaL < eps || alphaR < eps)
+                alphaL = alphaR = chord / 3.0f;
+
+            return { p0, Add(p0, Scale(tHat1, alphaL)), Add(p3, Scale(tHat2, alphaR)), p3 };
+        }
+
+        // ---------------------------------------------------------------------
+
+        // Maior distncia entre os pontos e a curva e onde ela ocorre
+        float MaxError(uint first, uint last, const Segment& s, const vector<float>& u, uint& split) const
+        {
+            float worst = 0.0f;
+            split = (first + last) / 2;
+
+            for (uint i = first + 1; i < last; ++i)
+            {
+                float dist = Length(Sub(Bezier::Point(s, u[i - first]), d[i]));
+                if (dist >= worst)
+                {
+                    worst = dist;
+                    split = i;
+                }
+            }
+
+            return worst;
+        }
+
+        // ---------------------------------------------------------------------
+
+        // Ajusta um nico segmento a f.first..f.last com as tangentes de f;
+        // devolve o maior erro e em split o ponto onde ele ocorre
+        float Single(Fitted& f, uint& split) const
+        {
+            ChordLength(f.first, f.last, f.u);
+            f.s = Generate(f.first, f.last, f.u, f.tHat1, f.tHat2);
+            float worst = MaxError(f.first, f.last, f.s, f.u, split);
+
+            // perto do alvo: tenta reparametrizar antes de dividir
+            for (int it = 0; worst >= error && worst < 4.0f * error && it < MaxIterations; ++it)
+            {
+                Reparameterize(d, f.first, f.last, f.s, f.u);
+                f.s = Generate(f.first, f.last, f.u, f.tHat1, f.tHat2);
+                worst = MaxError(f.first, f.last, f.s, f.u, split);
+            }
+
+            return worst;
+        }
+
+        // ---------------------------------------------------------------------
+
+        void Cubic(uint first, uint last, const XMFLOAT3& tHat1, const XMFLOAT3& tHat2)
+        {
+            Fitted f;
+            f.first = first;
+            f.last = last;
+            f.tHat1 = tHat1;
+            f.tHat2 = tHat2;
+
+            // dois pontos: reta com alas a um tero
+            if (last - first == 1)
+            {
+                float dist = Length(Sub(d[last], d[first])) / 3.0f;
+                f.s = { d[first], Add(d[first], Scale(tHat1, dist)), Add(d[last], Scale(tHat2, dist)), d[last] };
+                f.u = { 0.0f, 1.0f };
+                out.push_back(f);
+                return;
+            }
+
+            uint split;
+            if (Single(f, split) < error)
+            {
+                out.push_back(f);
+                return;
+            }
+
+            // divide no ponto de maior erro com uma tangente comum
+            XMFLOAT3 center = Normalize(Sub(d[split - 1], d[split + 1]));
+            Cubic(first, split, tHat1, center);
+            Cubic(split, last, Scale(center, -1.0f), tHat2);
+        }
+
+        // ---------------------------------------------------------------------
+
+        // Torna C1 as junes internas da cadeia a partir de start: os dois
+        // lados de cada juno passam a usar a mesma ala e todas as alas
+        // da cadeia so ajustadas juntas. Enquanto algum trecho passar do
+        // erro, o pior  dividido e a cadeia  ajustada de novo; trechos de
+        // dois pontos sempre cabem, ento o lao termina.
+        void Smooth(uint start)
+        {
+            for (;;)
+            {
+                vector<XMFLOAT3> h;
+                float worst = Handles(start, h);
+                for (int it = 0; worst >= error && it < SmoothIterations; ++it)
+                {
+                    for (uint j = start; j < out.size(); ++j)
+                        Reparameterize(d, out[j].first, out[j].last, out[j].s, out[j].u);
+                    worst = Handles(start, h);
+                }
+
+                if (worst < error)
+                    return;
+
+                // o trecho de maior erro  dividido nesse ponto
+                uint at = 0, split = 0;
+                worst = 0.0f;
+                for (uint j = start; j < out.size(); ++j)
+                {
+                    const Fitted& f = out[j];
+                    uint point;
+                    float dist = MaxError(f.first, f.last, f.s, f.u, point);
+                    if (dist > worst)
+                    {
+                        worst = dist;
+                        at = j;
+                        split = point;
+                    }
+                }
+
+                const Fitted& f = out[at];
+                XMFLOAT3 center = Normalize(Sub(d[split - 1], d[split + 1]));
+
+                Fitted head, tail;
+                head.first = f.first;
+                head.last = split;
+                head.tHat1 = f.tHat1;
+                head.tHat2 = center;
+                tail.first = split;
+                tail.last = f.last;
+                tail.tHat1 = Scale(center, -1.0f);
+                tail.tHat2 = f.tHat2;
+
+                uint unused;
+                Single(head, unused);
+                Single(tail, unused);
+
+                out[at] = head;
+                out.insert(out.begin() + at + 1, tail);
+            }
+        }
+
+        // ---------------------------------------------------------------------
+
+        float Chord(const Fitted& f) const
+        {
+            return Length(Sub(f.s.P[3], f.s.P[0]));
+        }
+
+        // ---------------------------------------------------------------------
+
+        // Resolve as alas da cadeia a partir de start com os parmetros
+        // atuais. Cada juno j tem um nico vetor h[j]: P2 do trecho da
+        // esquerda  a juno menos h[j] e P1 do da direita  a juno mais
+        // h[j]; h[0] e h[m] so as pontas. A curva  linear nesses vetores
+        // com coeficientes escalares, ento x e y saem do mesmo sistema
+        // tridiagonal. Um termo pequeno puxa cada ala para a tangente atual
+        // com um tero da corda, o que fixa as que nenhum ponto interno
+        // determina. Devolve o maior erro da cadeia
+        float Handles(uint start, vector<XMFLOAT3>& h)
+        {
+            uint m = uint(out.size()) - start;
+            vector<float> diag(m + 1, 0.0f), upper(m + 1, 0.0f);
+            vector<XMFLOAT3> rhs(m + 1, XMFLOAT3(0.0f, 0.0f, 0.0f));
+            vector<XMFLOAT3> target(m + 1, XMFLOAT3(0.0f, 0.0f, 0.0f));
+            vector<float> weight(m + 1, 0.0f);
+
+            for (uint j = 0; j < m; ++j)
+            {
+                const Fitted& f = out[start + j];
+                const XMFLOAT3& p0 = f.s.P[0];
+                const XMFLOAT3& p3 = f.s.P[3];
+
+                for (uint i = f.first; i <= f.last; ++i)
+                {
+                    float t = f.u[i - f.first];
+                    float s = 1.0f - t;
+                    float b0 = s * s * s, b1 = 3 * t * s * s, b2 = 3 * t * t * s, b3 = t * t * t;
+
+                    XMFLOAT3 tmp = Sub(d[i], Add(Scale(p0, b0 + b1), Scale(p3, b2 + b3)));
+                    diag[j] += b1 * b1;
+                    upper[j] -= b1 * b2;
+                    diag[j + 1] += b2 * b2;
+                    rhs[j] = Add(rhs[j], Scale(tmp, b1));
+                    rhs[j + 1] = Sub(rhs[j + 1], Scale(tmp, b2));
+                }
+
+                float third = Chord(f) / 3.0f;
+                target[j] = Add(target[j], Scale(f.tHat1, third));
+                target[j + 1] = Sub(target[j + 1], Scale(f.tHat2, third));
+                weight[j] += 1.0f;
+                weight[j + 1] += 1.0f;
+            }
+
+            const float Pull = 1e-3f;
+            for (uint j = 0; j <= m; ++j)
+            {
+                target[j] = Scale(target[j], 1.0f / weight[j]);
+                diag[j] += Pull;
+                rhs[j] = Add(rhs[j], Scale(target[j], Pull));
+            }
+
+            // eliminao de Thomas (a matriz  simtrica)
+            for (uint j = 1; j <= m; ++j)
+            {
+                float w = upper[j - 1] / diag[j - 1];
+                diag[j] -= w * upper[j - 1];
+                rhs[j] = Sub(rhs[j], Scale(rhs[j - 1], w));
+            }
+
+            h.assign(m + 1, XMFLOAT3(0.0f, 0.0f, 0.0f));
+            h[m] = Scale(rhs[m], 1.0f / diag[m]);
+            for (uint j = m; j-- > 0;)
+                h[j] = Scale(Sub(rhs[j], Scale(h[j + 1], upper[j])), 1.0f / diag[j]);
+
+            // nenhuma ala passa da corda vizinha (lao)
+            for (uint j = 0; j <= m; ++j)
+            {
+                float limit = FLT_MAX;
+                if (j > 0)
+                    limit = min(limit, Chord(out[start + j - 1]));
+                if (j < m)
+                    limit = min(limit, Chord(out[start + j]));
+
+                float len = Length(h[j]);
+                if (len == 0.0f)
+                    h[j] = target[j];
+                else if (len > limit)
+                    h[j] = Scale(h[j], limit / len);
+            }
+
+            float worst = 0.0f;
+            for (uint j = 0; j < m; ++j)
+            {
+                Fitted& f = out[start + j];
+                f.s.P[1] = Add(f.s.P[0], h[j]);
+                f.s.P[2] = Sub(f.s.P[3], h[j + 1]);
+                f.tHat1 = Normalize(h[j]);
+                f.tHat2 = Scale(Normalize(h[j + 1]), -1.0f);
+
+                uint split;
+                worst = max(worst, MaxError(f.first, f.last, f.s, f.u, split));
+            }
+
+            return worst;
+        }
+    };
+
+    // -------------------------------------------------------------------------
+
+    // Tangente mdia sobre alguns pontos a partir de from, no sentido de to
+    XMFLOAT3 Tangent(const vector<XMFLOAT3>& d, uint from, uint to)
+    {
+        const uint Window = 3;
+        uint n = from < to ? min(to - from, Window) : min(from - to, Window);
+        uint end = from < to ? from + n : from - n;
+        return Normalize(Sub(d[end], d[from]));
+    }
+
+    // -------------------------------------------------------------------------
+
+    // ngulo entre as direes de chegada e de sada do ponto i, medidas
+    // entre vizinhos a pelo menos span de distncia para ignorar o rudo
+    float Turn(const vector<XMFLOAT3>& d, uint i, float span)
+    {
+        uint a = i, b = i;
+        while (a > 0 && Length(Sub(d[i], d[a])) < span) --a;
+        while (b + 1 < d.size() && Length(Sub(d[b], d[i])) < span) ++b;
+
+        if (a == i || b == i)
+            return 0.0f;
+
+        XMFLOAT3 in = Normalize(Sub(d[i], d[a]));
+        XMFLOAT3 out = Normalize(Sub(d[b], d[i]));
+        return acos(max(-1.0f, min(1.0f, Dot(in, out))));
+    }
+
+    // -------------------------------------------------------------------------
+}
+
+// ------------------------------------------------------------------------------
+
+void CurveFit::Fit(const XMFLOAT3* points, uint count, float error, vector<Segment>& out, float cornerAngle)
+{
+    // descarta amostras repetidas (o mouse parado gera vrias)
+    vector<XMFLOAT3> d;
+    d.reserve(count);
+    for (uint i = 0; i < count; ++i)
+        if (d.empty() || Length(Sub(points[i], d.back())) > 1e-6f)
+            d.push_back(XMFLOAT3(points[i].x, points[i].y, 0.0f));
+
+    if (d.size() < 2)
+        return;
+
+    // quinas: mximos locais da mudana de direo acima do limite
+    uint n = uint(d.size());
+    float span = 2.0f * error;
+    vector<float> turn(n, 0.0f);
+    for (uint i = 1; i + 1 < n; ++i)
+        turn[i] = Turn(d, i, span);
+
+    vector<uint> breaks = { 0 };
+    for (uint i = 1; i + 1 < n; ++i)
+        if (turn[i] > cornerAngle && turn[i] >= turn[i - 1] && turn[i] > turn[i + 1])
+            breaks.push_back(i);
+    breaks.push_back(n - 1);
+
+    // ajusta cada trecho entre quinas separadamente
+    vector<Fitted> chain;
+    Fitter fitter(d, error, chain);
+
+    for (uint k = 0; k + 1 < breaks.size(); ++k)
+    {
+        uint first = breaks[k];
+        uint last = breaks[k + 1];
+        uint start = uint(chain.size());
+
+        fitter.Cubic(first, last, Tangent(d, first, last), Tangent(d, last, first));
+        fitter.Smooth(start);
+    }
+
+    for (const Fitted& f : chain)
+        out.push_back(f.s);
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,36 @@
+/**********************************************************************************
+// CurveFit (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Ajuste de cadeias de cbicas a traos  mo livre (Schneider)
+//
+**********************************************************************************/
+
+#ifndef _CURVEFIT_H_
+#define _CURVEFIT_H_
+
+#include "Bezier.h"
+#include <vector>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+namespace CurveFit
+{
+    // mudana de direo (em radianos) a partir da qual um ponto vira quina
+    const float CornerAngle = 1.0f;
+
+    // Ajusta uma cadeia de segmentos cbicos aos pontos amostrados, com
+    // distncia mxima error entre a curva e os pontos. Entre quinas todas
+    // as junes so C1 (a mesma ala dos dois lados), mesmo que isso
+    // exija mais segmentos; nas quinas a cadeia  apenas contnua.
+    void Fit(const XMFLOAT3* points, uint count, float error, vector<Segment>& out,
+             float cornerAngle = CornerAngle);
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
@@ -29,10 +29,17 @@ void Curves::Init()
     ctrlPoint2      = new Mesh(vbSizeCtrl, sizeof(Vertex));
     curve           = new Mesh(vbSizeCurve, sizeof(Vertex));
     finalCurve      = new Mesh(vbSizeCurve, sizeof(Vertex));
+    thickCurve      = new Mesh(MaxStroke * sizeof(Vertex), sizeof(Vertex));
     squarePoint1    = new Mesh(vbSizeSquare, sizeof(Vertex));
     squarePoint2    = new Mesh(vbSizeSquare, sizeof(Vertex));
     squarePoint3    = new Mesh(vbSizeSquare, sizeof(Vertex));
     squarePoint4    = new Mesh(vbSizeSquare, sizeof(Vertex));
+    hoverPoint      = new Mesh(vbSizeSquare, sizeof(Vertex));
+
+    // a expanso s escreve posies: a cor da arena  definida uma vez
+    strokeArena.assign(MaxStroke, { XMFLOAT3(0.0f, 0.0f, 0.0f), XMFLOAT4(Colors::Yellow) });
+    strokeX.resize(MaxCurve);
+    strokeY.resize(MaxCurve);
 
     // ---------------------------------------
 
@@ -66,8 +73,49 @@ void Curves::Update()
     if (input->KeyPress('L'))
         LoadCurve();
 
+    if (input->KeyPress('C'))
+        fileTask.Cancel();
+
+    // liga e desliga a simplificao das curvas finais
+    if (input->KeyPress('P'))
+    {
+        simplify = !simplify;
+        drawDirty = true;
+    }
+
+    // espessura das curvas finais: liga e desliga, troca junes e terminaes
+    if (input->KeyPress('W'))
+    {
+        thick = !thick;
+        drawDirty = true;
+    }
+
+    if (input->KeyPress('J'))
+    {
+        strokeStyle.join = Stroke::Join((strokeStyle.join + 1) % 3);
+        drawDirty = true;
+    }
+
+    if (input->KeyPress('K'))
+    {
+        strokeStyle.cap = Stroke::Cap((strokeStyle.cap + 1) % 3);
+        drawDirty = true;
+    }
+
+    PollFile();
+
+    if (input->KeyDown(VK_CONTROL) && input->KeyPress('Z'))
+        Undo();
+
+    if (input->KeyDown(VK_CONTROL) && input->KeyPress('Y'))
+        Redo();
+
+    // Destaca o ponto da curva sob o cursor
+    UpdateHover();
+
     // Cria vrtices com o boto do mouse
     CreateVertices();
+    CreateStroke();
     DrawVertices();
 
     Display();
@@ -81,8 +129,23 @@ void Curves::CreateVertices()
     float x = (mx - cx) / cx;
     float y = (cy - my) / cy;
 
-    if (input->KeyPress(VK_LBUTTON))
+    // com a cena cheia, o clique que comearia um novo segmento  recusado
+    // (CreateCurve e StoreSegments seguem o mesmo limite)
+    bool full = segments.Size() >= MaxCurve / SegmentVertices && (clickCount == 0 || clickCount == 2);
+
+    if (input->KeyPress(VK_LBUTTON) && full)
     {
+        OutputDebugString("Limite de segmentos atingido: clique ignorado\n");
+    }
+    else if (input->KeyPress(VK_LBUTTON))
+    {
+        // ncoras perto de uma curva grudam no ponto destacado
+        if (hovering)
+        {
+            x = hover.point.x;
+            y = hover.point.y;
+        }
+
         switch (clickCount)
         {
             case 0:
@@ -118,7 +181,6 @@ void Curves::CreateVertices()
                 ctrl2[index] = { XMFLOAT3(x, y, 0.0f), XMFLOAT4(Colors::DarkRed) };
                 ctrlCount2 += 3;
                 
-                ++totalCurves;
                 createCurve = true;
                 fix = true;
             break;
@@ -140,8 +202,7 @@ void Curves::CreateVertices()
 
     DrawSquares();
 
-    if(totalCurves >= 1)
-        DrawCurve();
+    DrawCurve();
 }
 
 // ------------------------------------------------------------------------------
@@ -184,25 +245,15 @@ void Curves::DrawVertices()
 // Cria uma curva
 void Curves::CreateCurve()
 {
-    float segments = 50;
-    float t;
+    Segment segment = { ctrl1[1].Pos, ctrl1[2].Pos, ctrl2[2].Pos, ctrl2[1].Pos };
 
-    for (int i = 0; i < segments; i++)
-    {
-        t = i / float(segments - 1);
-        float alpha = pow((1 - t), 3);
-        float beta = 3 * t * pow((1 - t), 2);
-        float gama = 3 * pow(t, 2) * (1 - t);
-        float teta = pow(t, 3);
+    // amostras uniformes em t; s as posies so usadas
+    Frames frames;
+    frames.Evaluate(segment, 0, SegmentVertices);
 
-        XMFLOAT3 point =
-        {
-            alpha * ctrl1[1].Pos.x + beta * ctrl1[2].Pos.x + gama * ctrl2[2].Pos.x + teta * ctrl2[1].Pos.x,
-            alpha * ctrl1[1].Pos.y + beta * ctrl1[2].Pos.y + gama * ctrl2[2].Pos.y + teta * ctrl2[1].Pos.y,
-            0.0f
-        };
-
-        curvePoints[curveIndex] = { point, XMFLOAT4(Colors::Yellow) };
+    for (uint i = 0; i < SegmentVertices; i++)
+    {
+        curvePoints[curveIndex] = { XMFLOAT3(frames.x[i], frames.y[i], 0.0f), XMFLOAT4(Colors::Yellow) };
         curveIndex = (curveIndex + 1) % 50;
 
         if (curveCount < 50)
@@ -215,17 +266,21 @@ void Curves::CreateCurve()
         newCurve = false;
         createCurve = false;
 
-        curveIndex = 50 * (totalCurves - 1);
-        for (int i = 0; i < segments; i++)
+        // as amostras vo para a faixa do segmento em showCurves, indexada
+        // pela posio que ele ter na cena, como em StoreSegments
+        uint slot = segments.Size();
+        if (slot < MaxCurve / SegmentVertices)
         {
-            showCurves[curveIndex] = curvePoints[i];
-            curveIndex = (curveIndex + 1) % (50 * totalCurves);
-
-            if(curveCount2 < 50 * totalCurves)
-                ++curveCount2;
+            memcpy(showCurves + SegmentVertices * slot, curvePoints, SegmentVertices * sizeof(Vertex));
+            curveCount2 = SegmentVertices * (slot + 1);
+            AddSegments(&segment, 1);
+        }
+        else
+        {
+            OutputDebugString("Limite de segmentos atingido: curva descartada\n");
         }
 
-        curveIndex = 50 * totalCurves;
+        curveIndex = 0;
         curveCount = 0;
 
         XMFLOAT3 newPoint = {
@@ -247,96 +302,374 @@ void Curves::CreateCurve()
 
 // ------------------------------------------------------------------------------
 
-// Salva as informaes da curva em um arquivo binrio
-void Curves::SaveCurve()
+// Captura um trao  mo livre enquanto o boto direito estiver pressionado
+// e o converte em uma cadeia de segmentos ao soltar o boto
+void Curves::CreateStroke()
 {
-    ofstream fout("saveCurve.bin", ios::binary);
-
-    saveCurve = true;
-    if (fout.is_open())
-    {
-        // Salvando ctrl1 e ctrl2
-        fout.write((char*)&ctrlCount1, sizeof(ctrlCount1));
-        fout.write((char*)ctrl1, ctrlCount1 * sizeof(Vertex));
-
-        fout.write((char*)&ctrlCount2, sizeof(ctrlCount2));
-        fout.write((char*)ctrl2, ctrlCount2 * sizeof(Vertex));
-
-        // Salvando curvePoints e showCurves
-        fout.write((char*)&curveCount, sizeof(curveCount));
-        fout.write((char*)curvePoints, curveCount * sizeof(Vertex));
-        
-        fout.write((char*)&curveCount2, sizeof(curveCount2));
-        fout.write((char*)showCurves, curveCount2 * sizeof(Vertex));
-
-        // Salvando Squares
-        fout.write((char*)&back1, MaxSquareVertex * sizeof(Vertex));
-        fout.write((char*)&back2, MaxSquareVertex * sizeof(Vertex));
-        fout.write((char*)&back3, MaxSquareVertex * sizeof(Vertex));
-        fout.write((char*)&back4, MaxSquareVertex * sizeof(Vertex));
-
-        // Salvando outras variveis
-        fout.write((char*)&index, sizeof(index));
-        fout.write((char*)&clickCount, sizeof(clickCount));
-        fout.write((char*)&curveIndex, sizeof(curveIndex));
-        fout.write((char*)&totalCurves, sizeof(totalCurves));
-
-        // Salvando variveis bool
-        fout.write((char*)&newCurve, sizeof(newCurve));
-        fout.write((char*)&createCurve, sizeof(createCurve));
-        fout.write((char*)&canDraw, sizeof(canDraw));
-        fout.write((char*)&fix, sizeof(fix));
-        fout.write((char*)&erase, sizeof(erase));
-        
-        fout.close();
+    // s entre curvas: com um segmento pendente a faixa dele j est reservada
+    if (clickCount != 0 && clickCount != 2)
+    {
+        stroke.clear();
+        return;
+    }
+
+    float x = (mx - cx) / cx;
+    float y = (cy - my) / cy;
+
+    if (input->KeyDown(VK_RBUTTON))
+    {
+        if (stroke.empty() || stroke.back().x != x || stroke.back().y != y)
+            stroke.push_back(XMFLOAT3(x, y, 0.0f));
+    }
+    else if (!stroke.empty())
+    {
+        vector<Segment> fitted;
+        CurveFit::Fit(stroke.data(), uint(stroke.size()), StrokeError / cx, fitted);
+
+        // o trao inteiro  uma nica edio
+        StoreSegments(fitted.data(), uint(fitted.size()));
+
+        stroke.clear();
     }
 }
 
 // ------------------------------------------------------------------------------
 
-// Carrega as informaes de uma curva salva de um arquivo binrio
+// Acrescenta uma cadeia de segmentos prontos s curvas finais; os que no
+// cabem mais na amostragem de showCurves so descartados e informados
+void Curves::StoreSegments(const Segment* items, uint n)
+{
+    const uint maxSegments = MaxCurve / SegmentVertices;
+    uint first = segments.Size();
+    uint room = first < maxSegments ? maxSegments - first : 0;
+
+    if (n > room)
+    {
+        string report = "Limite de segmentos atingido: " + to_string(n - room) + " de " + to_string(n)
+            + " segmentos do traco descartados\n";
+        OutputDebugString(report.c_str());
+        n = room;
+    }
+
+    if (n == 0)
+        return;
+
+    for (uint k = 0; k < n; ++k)
+        Tessellate(items[k], showCurves + SegmentVertices * (first + k));
+
+    curveCount2 = SegmentVertices * (first + n);
+
+    AddSegments(items, n);
+}
+
+// ------------------------------------------------------------------------------
+
+// Amostra um segmento uniformemente em t
+void Curves::Tessellate(const Segment& s, Vertex* out) const
+{
+    Frames frames;
+    frames.Evaluate(s, 0, SegmentVertices);
+
+    for (uint i = 0; i < SegmentVertices; ++i)
+        out[i] = { XMFLOAT3(frames.x[i], frames.y[i], 0.0f), XMFLOAT4(Colors::Yellow) };
+}
+
+// ------------------------------------------------------------------------------
+
+// Guarda uma cadeia de segmentos definitivos como uma nica verso e
+// calcula onde ela cruza a cena (cada segmento contra os anteriores)
+void Curves::AddSegments(const Segment* items, uint n)
+{
+    crossings.clear();
+    if (n == 0)
+        return;
+
+    uint base = segments.Size();
+    SegmentList version = segments.Append(items, n);
+    vector<Crossing> found;
+
+    scene.bounds.resize(base + n);
+    stale.resize(base + n, false);
+    scene.projector.Resize(base + n);
+
+    for (uint k = 0; k < n; ++k)
+    {
+        const Segment& s = items[k];
+        uint i = base + k;
+
+        // a rvore ainda s tem os segmentos anteriores a este
+        found.clear();
+        Intersection::Query(s, version, scene.tree, found);
+
+        // a juno com o segmento anterior da spline no  um cruzamento
+        bool joined = false;
+        if (i > 0)
+        {
+            uint last = i - 1;
+            const XMFLOAT3& joint = version[last].P[3];
+
+            joined = joint.x == s.P[0].x && joint.y == s.P[0].y;
+            if (joined)
+            {
+                found.erase(remove_if(found.begin(), found.end(),
+                    [last](const Crossing& c) { return c.segment == last && c.hit.t <= 1e-3f && c.hit.u >= 1.0f - 1e-3f; }),
+                    found.end());
+            }
+        }
+
+        crossings.insert(crossings.end(), found.begin(), found.end());
+
+        // segmento solto inicia uma nova spline
+        if (!joined)
+            scene.splines.push_back(i);
+
+        scene.bounds[i] = Bezier::Bounds(s);
+        scene.projector.Set(i, s);
+        scene.tree.Insert(i, scene.bounds[i]);
+    }
+
+    segments = version;
+    history.Commit(segments);
+    snapshots.Publish(segments);
+    scene.splineTree.Append(scene.bounds.data(), uint(scene.bounds.size()), scene.splines);
+    hoverDirty = true;
+    drawDirty = true;
+}
+
+// ------------------------------------------------------------------------------
+
+// Recalcula todo o ndice da cena; a amostragem fica para quando cada
+// segmento aparecer na janela
+void Curves::BuildSceneIndex()
+{
+    scene.Build(segments);
+    ResetScene();
+}
+
+// ------------------------------------------------------------------------------
+
+// Depois que o ndice inteiro foi trocado: descarta amostras e cruzamentos
+// e publica a verso para as threads de leitura
+void Curves::ResetScene()
+{
+    stale.assign(segments.Size(), true);
+    crossings.clear();
+    hoverDirty = true;
+    drawDirty = true;
+
+    snapshots.Publish(segments);
+}
+
+// ------------------------------------------------------------------------------
+
+// Procura o ponto das curvas finais mais prximo do cursor; s refaz a
+// busca quando o cursor se move ou a cena muda
+void Curves::UpdateHover()
+{
+    if (!hoverDirty && mx == hoverX && my == hoverY)
+        return;
+
+    hoverDirty = false;
+    hoverX = mx;
+    hoverY = my;
+
+    XMFLOAT3 cursor = { (mx - cx) / cx, (cy - my) / cy, 0.0f };
+    float radius = SnapRadius / cx;
+
+    bool found = scene.projector.Nearest(segments, scene.tree, cursor, radius, hover);
+
+    // cruzamentos do ltimo segmento tm preferncia sobre o resto da curva
+    for (const Crossing& c : crossings)
+    {
+        float d = hypot(c.point.x - cursor.x, c.point.y - cursor.y);
+        if (d <= radius)
+        {
+            hover = { c.segment, c.hit.u, d, c.point };
+            radius = d;
+            found = true;
+        }
+    }
+
+    if (!found && !hovering)
+        return;
+
+    hovering = found;
+
+    Vertex square[MaxSquareVertex] = {};
+    if (hovering)
+    {
+        float xx = hover.point.x;
+        float yy = hover.point.y;
+
+        square[0] = { XMFLOAT3(xx - 0.01f, yy - 0.01f, 0.0f), XMFLOAT4(Colors::Cyan) };
+        square[1] = { XMFLOAT3(xx + 0.01f, yy - 0.01f, 0.0f), XMFLOAT4(Colors::Cyan) };
+        square[2] = { XMFLOAT3(xx + 0.01f, yy + 0.01f, 0.0f), XMFLOAT4(Colors::Cyan) };
+        square[3] = { XMFLOAT3(xx - 0.01f, yy + 0.01f, 0.0f), XMFLOAT4(Colors::Cyan) };
+        square[4] = { XMFLOAT3(xx - 0.01f, yy - 0.01f, 0.0f), XMFLOAT4(Colors::Cyan) };
+    }
+
+    graphics->ResetCommands();
+    graphics->Copy(square, hoverPoint->vertexBufferSize, hoverPoint->vertexBufferUpload, hoverPoint->vertexBufferGPU);
+    graphics->SubmitCommands();
+}
+
+// ------------------------------------------------------------------------------
+
+// Salva as informaes da curva em um arquivo binrio, em segundo plano:
+// o estado de edio  copiado agora e a thread de gravao l a verso
+// mais recente da cena publicada em snapshots
+void Curves::SaveCurve()
+{
+    ostringstream state(ios::binary);
+    WriteState(state);
+
+    saveCurve = fileTask.Save("saveCurve.bin", state.str(), snapshots);
+}
+
+// ------------------------------------------------------------------------------
+
+// Carrega as informaes de uma curva salva de um arquivo binrio; a cena 
+// substituda quando a leitura em segundo plano termina (ver PollFile)
 void Curves::LoadCurve()
 {
-    ifstream fin("saveCurve.bin", ios::binary);
-
-    loadCurve = true;
-    if (fin.is_open())
-    {
-        // Lendo ctrl1 e ctrl2
-        fin.read((char*)&ctrlCount1, sizeof(ctrlCount1));
-        fin.read((char*)ctrl1, ctrlCount1 * sizeof(Vertex));
-
-        fin.read((char*)&ctrlCount2, sizeof(ctrlCount2));
-        fin.read((char*)ctrl2, ctrlCount2 * sizeof(Vertex));
-
-        // Lendo curvePoints e showCurves
-        fin.read((char*)&curveCount, sizeof(curveCount));
-        fin.read((char*)curvePoints, curveCount * sizeof(Vertex));
-        
-        fin.read((char*)&curveCount2, sizeof(curveCount2));
-        fin.read((char*)showCurves, curveCount2 * sizeof(Vertex));
-
-        // Lendo Squares
-        fin.read((char*)&back1, MaxSquareVertex * sizeof(Vertex));
-        fin.read((char*)&back2, MaxSquareVertex * sizeof(Vertex));
-        fin.read((char*)&back3, MaxSquareVertex * sizeof(Vertex));
-        fin.read((char*)&back4, MaxSquareVertex * sizeof(Vertex));
-
-        // Lendo outras variveis
-        fin.read((char*)&index, sizeof(index));
-        fin.read((char*)&clickCount, sizeof(clickCount));
-        fin.read((char*)&curveIndex, sizeof(curveIndex));
-        fin.read((char*)&totalCurves, sizeof(totalCurves));
-
-        // Lendo variveis bool
-        fin.read((char*)&newCurve, sizeof(newCurve));
-        fin.read((char*)&createCurve, sizeof(createCurve));
-        fin.read((char*)&canDraw, sizeof(canDraw));
-        fin.read((char*)&fix, sizeof(fix));
-        fin.read((char*)&erase, sizeof(erase));
-
-        fin.close();
+    fileTask.Load("saveCurve.bin");
+}
+
+// ------------------------------------------------------------------------------
+
+// Acompanha a tarefa de arquivo em andamento
+void Curves::PollFile()
+{
+    FileTask::State state = fileTask.Poll();
+
+    if (state == FileTask::Idle)
+        return;
+
+    if (state == FileTask::Running)
+    {
+        // informa o progresso a cada 10%
+        uint step = uint(fileTask.Progress() * 10.0f);
+        if (step != fileProgress)
+        {
+            fileProgress = step;
+            string report = (fileTask.Saving() ? "Salvando... " : "Carregando... ") + to_string(step * 10) + "%\n";
+            OutputDebugString(report.c_str());
+        }
+        return;
+    }
+
+    if (state == FileTask::Done && !fileTask.Saving())
+    {
+        istringstream in(fileTask.Header(), ios::binary);
+        ReadState(in);
+
+        // carregar no  uma edio: o histrico recomea
+        segments = fileTask.Segments();
+        history.Reset(segments);
+
+        // o ndice foi montado pela thread de leitura: s  trocado
+        swap(scene, fileTask.Index());
+        ResetScene();
+
+        // a verso gravada pode ser mais nova que o estado copiado antes
+        // dela; showCurves  indexado pelos segmentos (ver ShowVersion), e
+        // um segmento pendente no estado vai para a posio segments.Size()
+        if (!fileTask.Legacy())
+        {
+            const uint maxSegments = MaxCurve / SegmentVertices;
+            curveCount2 = SegmentVertices * min(segments.Size(), maxSegments);
+        }
+        curveIndex %= SegmentVertices;
+
+        loadCurve = true;
     }
+
+    if (state == FileTask::Failed)
+        OutputDebugString("Falha ao acessar saveCurve.bin\n");
+
+    fileProgress = 0;
+    fileTask.Reset();
+}
+
+// ------------------------------------------------------------------------------
+
+// Grava o estado de edio (tudo menos os segmentos)
+void Curves::WriteState(ostream& fout)
+{
+    // Salvando ctrl1 e ctrl2
+    fout.write((char*)&ctrlCount1, sizeof(ctrlCount1));
+    fout.write((char*)ctrl1, ctrlCount1 * sizeof(Vertex));
+
+    fout.write((char*)&ctrlCount2, sizeof(ctrlCount2));
+    fout.write((char*)ctrl2, ctrlCount2 * sizeof(Vertex));
+
+    // Salvando curvePoints e showCurves
+    fout.write((char*)&curveCount, sizeof(curveCount));
+    fout.write((char*)curvePoints, curveCount * sizeof(Vertex));
+    
+    fout.write((char*)&curveCount2, sizeof(curveCount2));
+    fout.write((char*)showCurves, curveCount2 * sizeof(Vertex));
+
+    // Salvando Squares
+    fout.write((char*)&back1, MaxSquareVertex * sizeof(Vertex));
+    fout.write((char*)&back2, MaxSquareVertex * sizeof(Vertex));
+    fout.write((char*)&back3, MaxSquareVertex * sizeof(Vertex));
+    fout.write((char*)&back4, MaxSquareVertex * sizeof(Vertex));
+
+    // Salvando outras variveis (o formato guarda o nmero de segmentos
+    // amostrados, que hoje sai de segments e no  mais lido)
+    uint cached = curveCount2 / SegmentVertices;
+    fout.write((char*)&index, sizeof(index));
+    fout.write((char*)&clickCount, sizeof(clickCount));
+    fout.write((char*)&curveIndex, sizeof(curveIndex));
+    fout.write((char*)&cached, sizeof(cached));
+
+    // Salvando variveis bool
+    fout.write((char*)&newCurve, sizeof(newCurve));
+    fout.write((char*)&createCurve, sizeof(createCurve));
+    fout.write((char*)&canDraw, sizeof(canDraw));
+    fout.write((char*)&fix, sizeof(fix));
+    fout.write((char*)&erase, sizeof(erase));
+}
+
+// ------------------------------------------------------------------------------
+
+// L o estado de edio gravado por WriteState
+void Curves::ReadState(istream& fin)
+{
+    // Lendo ctrl1 e ctrl2
+    fin.read((char*)&ctrlCount1, sizeof(ctrlCount1));
+    fin.read((char*)ctrl1, ctrlCount1 * sizeof(Vertex));
+
+    fin.read((char*)&ctrlCount2, sizeof(ctrlCount2));
+    fin.read((char*)ctrl2, ctrlCount2 * sizeof(Vertex));
+
+    // Lendo curvePoints e showCurves
+    fin.read((char*)&curveCount, sizeof(curveCount));
+    fin.read((char*)curvePoints, curveCount * sizeof(Vertex));
+    
+    fin.read((char*)&curveCount2, sizeof(curveCount2));
+    fin.read((char*)showCurves, curveCount2 * sizeof(Vertex));
+
+    // Lendo Squares
+    fin.read((char*)&back1, MaxSquareVertex * sizeof(Vertex));
+    fin.read((char*)&back2, MaxSquareVertex * sizeof(Vertex));
+    fin.read((char*)&back3, MaxSquareVertex * sizeof(Vertex));
+    fin.read((char*)&back4, MaxSquareVertex * sizeof(Vertex));
+
+    // Lendo outras variveis
+    uint cached = 0;
+    fin.read((char*)&index, sizeof(index));
+    fin.read((char*)&clickCount, sizeof(clickCount));
+    fin.read((char*)&curveIndex, sizeof(curveIndex));
+    fin.read((char*)&cached, sizeof(cached));
+
+    // Lendo variveis bool
+    fin.read((char*)&newCurve, sizeof(newCurve));
+    fin.read((char*)&createCurve, sizeof(createCurve));
+    fin.read((char*)&canDraw, sizeof(canDraw));
+    fin.read((char*)&fix, sizeof(fix));
+    fin.read((char*)&erase, sizeof(erase));
 }
 
 // ------------------------------------------------------------------------------
@@ -349,6 +682,14 @@ void Curves::DeleteCurve()
     memset(showCurves, 0, sizeof(showCurves));
     memset(ctrl1, 0, sizeof(ctrl1));
     memset(ctrl2, 0, sizeof(ctrl2));
+    // apagar pode ser desfeito como qualquer outra edio
+    if (!segments.Empty())
+    {
+        segments = SegmentList();
+        history.Commit(segments);
+    }
+    stroke.clear();
+    BuildSceneIndex();
     ctrlCount1 = 0;
     ctrlCount2 = 0;
     index = 0;
@@ -356,7 +697,6 @@ void Curves::DeleteCurve()
     curveCount = 0;
     curveCount2 = 0;
     curveIndex = 0;
-    totalCurves = 0;
     newCurve = false;
     createCurve = false;
     canDraw = false;
@@ -365,10 +705,243 @@ void Curves::DeleteCurve()
 
 // ------------------------------------------------------------------------------
 
+// Desfaz a ltima edio das curvas finais
+void Curves::Undo()
+{
+    if (history.Undo())
+        ShowVersion();
+}
+
+// ------------------------------------------------------------------------------
+
+// Refaz a ltima edio desfeita
+void Curves::Redo()
+{
+    if (history.Redo())
+        ShowVersion();
+}
+
+// ------------------------------------------------------------------------------
+
+// Exibe a verso atual do histrico sem reconstruir os ndices: caixas,
+// tabelas e a rvore da cena mudam apenas nos blocos de segmentos que ela
+// no compartilha com a verso exibida at agora, e as splines so refeitas
+// a partir do primeiro desses blocos. Os segmentos alterados so amostrados
+// de novo quando ficarem visveis.
+void Curves::ShowVersion()
+{
+    const SegmentList& version = history.Current();
+    const uint maxSegments = MaxCurve / SegmentVertices;
+    const uint count = version.Size();
+
+    // segmentos que saram da cena
+    for (uint i = count; i < segments.Size(); ++i)
+        scene.tree.Remove(i);
+
+    scene.bounds.resize(count);
+    scene.projector.Resize(count);
+    stale.resize(count, true);
+
+    uint kept = min(count, segments.Size());
+
+    version.Changed(segments, [&](uint first, uint n)
+    {
+        kept = min(kept, first);
+
+        for (uint i = first; i < first + n; ++i)
+        {
+            scene.bounds[i] = Bezier::Bounds(version[i]);
+            scene.projector.Set(i, version[i]);
+            stale[i] = true;
+
+            scene.tree.Remove(i);
+            scene.tree.Insert(i, scene.bounds[i]);
+        }
+    });
+
+    // splines a partir do primeiro segmento alterado
+    while (!scene.splines.empty() && scene.splines.back() >= kept)
+        scene.splines.pop_back();
+
+    for (uint i = kept; i < count; ++i)
+    {
+        if (i == 0 || version[i - 1].P[3].x != version[i].P[0].x || version[i - 1].P[3].y != version[i].P[0].y)
+            scene.splines.push_back(i);
+    }
+
+    scene.splineTree.Truncate(kept);
+    scene.splineTree.Append(scene.bounds.data(), count, scene.splines);
+
+    segments = version;
+    curveCount2 = SegmentVertices * min(segments.Size(), maxSegments);
+
+    crossings.clear();
+    hoverDirty = true;
+    drawDirty = true;
+    snapshots.Publish(segments);
+
+    // a curva em edio  descartada e a prxima comea do zero
+    memset(curvePoints, 0, sizeof(curvePoints));
+    memset(ctrl1, 0, sizeof(ctrl1));
+    memset(ctrl2, 0, sizeof(ctrl2));
+    ctrlCount1 = 0;
+    ctrlCount2 = 0;
+    index = 0;
+    clickCount = 0;
+    curveCount = 0;
+    curveIndex = 0;
+    newCurve = false;
+    createCurve = false;
+    canDraw = false;
+    fix = false;
+    erase = true;
+    stroke.clear();
+}
+
+// ------------------------------------------------------------------------------
+
+// Monta a lista de desenho com as faixas de segmentos visveis na janela,
+// amostrando os que estiverem pendentes, e envia s esses vrtices  GPU.
+// Com a simplificao ligada, cada segmento perde os vrtices que no
+// mudam o desenho em mais de SimplifyError pixels (as ncoras ficam).
+// Com espessura, as faixas viram tringulos em ExpandStrokes.
+// Nada  refeito enquanto a cena e a janela no mudam.
 void Curves::DrawCurve()
 {
+    if (!drawDirty)
+        return;
+
+    drawDirty = false;
+    drawRuns.clear();
+    strokeRuns.clear();
+
+    const uint maxSegments = MaxCurve / SegmentVertices;
+    const XMFLOAT2 pixels = { cx, cy };
+    auto position = [](const Vertex& v) -> const XMFLOAT3& { return v.Pos; };
+
+    Polyline::Reduction reduction;
+    uint count = 0;
+
+    // arquivos antigos no tm segmentos, s os vrtices de uma spline
+    if (segments.Empty() && curveCount2 > 0)
+    {
+        memcpy(visibleCurves, showCurves, curveCount2 * sizeof(Vertex));
+        drawRuns.push_back({ 0, curveCount2 });
+        count = curveCount2;
+    }
+
+    scene.splineTree.Visible(view, [&](uint first, uint n)
+    {
+        if (first >= maxSegments)
+            return;
+
+        n = min(n, maxSegments - first);
+        uint start = count;
+
+        for (uint i = first; i < first + n; ++i)
+        {
+            if (stale[i])
+            {
+                Tessellate(segments[i], showCurves + SegmentVertices * i);
+                stale[i] = false;
+            }
+
+            // dentro da faixa o incio de um segmento repete o fim do anterior
+            Vertex* dst = visibleCurves + (i > first ? count - 1 : count);
+            memcpy(dst, showCurves + SegmentVertices * i, SegmentVertices * sizeof(Vertex));
+
+            uint m = simplify
+                ? Polyline::Simplify(dst, SegmentVertices, pixels, SimplifyError, position, &reduction)
+                : SegmentVertices;
+
+            count = uint(dst - visibleCurves) + m;
+        }
+
+        drawRuns.push_back({ start, count - start });
+    });
+
+    if (simplify && reduction.input > 0)
+    {
+        string report = "Simplificacao: " + to_string(reduction.output) + " de " + to_string(reduction.input)
+            + " vertices (" + to_string(int(reduction.Ratio() * 100.0f + 0.5f)) + "% removidos)\n";
+        OutputDebugString(report.c_str());
+    }
+
+    if (count == 0)
+        return;
+
+    if (thick)
+    {
+        ExpandStrokes(count);
+        return;
+    }
+
+    graphics->ResetCommands();
+    graphics->Copy(visibleCurves, count * sizeof(Vertex), finalCurve->vertexBufferUpload, finalCurve->vertexBufferGPU);
+    graphics->SubmitCommands();
+}
+
+// ------------------------------------------------------------------------------
+
+// Expande as faixas de drawRuns em faixas de tringulos com a espessura de
+// strokeStyle. Cada faixa recebe uma fatia da arena do tamanho do seu pior
+// caso e as faixas so expandidas em paralelo; em seguida as fatias so
+// compactadas e enviadas  GPU numa nica cpia.
+void Curves::ExpandStrokes(uint count)
+{
+    for (uint i = 0; i < count; ++i)
+    {
+        strokeX[i] = visibleCurves[i].Pos.x;
+        strokeY[i] = visibleCurves[i].Pos.y;
+    }
+
+    // fatias da arena; faixas que no cabem mais ficam sem trao
+    uint reserved = 0;
+    uint vertices = 0;
+    for (const Run& run : drawRuns)
+    {
+        uint capacity = Stroke::Capacity(run.count, strokeStyle);
+        if (reserved + capacity > MaxStroke)
+            break;
+
+        strokeRuns.push_back({ reserved, capacity });
+        reserved += capacity;
+        vertices += run.count;
+    }
+
+    // cada thread recebe faixas com pelo menos StrokeGrain vrtices;
+    // abaixo disso criar threads custa mais que expandir na chamadora
+    uint runs = uint(strokeRuns.size());
+    uint grain = vertices > 0 ? uint((unsigned long long)runs * StrokeGrain / vertices) : runs;
+    grain = max(grain, 1u);
+
+    const XMFLOAT2 pixels = { cx, cy };
+
+    ParallelFor(runs, [&](uint r)
+    {
+        const Run& run = drawRuns[r];
+        strokeRuns[r].count = Stroke::Expand(strokeX.data() + run.first, strokeY.data() + run.first, run.count,
+            strokeStyle, pixels, &strokeArena[strokeRuns[r].first].Pos, sizeof(Vertex));
+    }, grain);
+
+    uint packed = 0;
+    for (Run& run : strokeRuns)
+    {
+        if (run.first != packed)
+            memmove(&strokeArena[packed], &strokeArena[run.first], run.count * sizeof(Vertex));
+
+        run.first = packed;
+        packed += run.count;
+    }
+
+    strokeRuns.erase(remove_if(strokeRuns.begin(), strokeRuns.end(),
+        [](const Run& run) { return run.count == 0; }), strokeRuns.end());
+
+    if (packed == 0)
+        return;
+
     graphics->ResetCommands();
-    graphics->Copy(showCurves, finalCurve->vertexBufferSize, finalCurve->vertexBufferUpload, finalCurve->vertexBufferGPU);
+    graphics->Copy(strokeArena.data(), packed * sizeof(Vertex), thickCurve->vertexBufferUpload, thickCurve->vertexBufferGPU);
     graphics->SubmitCommands();
 }
 
@@ -586,8 +1159,23 @@ void Curves::Display()
     graphics->CommandList()->DrawInstanced(curveCount, 1, 0, 0);
 
     // Desenhar curva final
-    graphics->CommandList()->IASetVertexBuffers(0, 1, finalCurve->VertexBufferView());
-    graphics->CommandList()->DrawInstanced(curveCount2, 1, 0, 0);
+    if (thick)
+    {
+        graphics->CommandList()->SetPipelineState(strokePipeline);
+        graphics->CommandList()->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+        graphics->CommandList()->IASetVertexBuffers(0, 1, thickCurve->VertexBufferView());
+        for (const Run& run : strokeRuns)
+            graphics->CommandList()->DrawInstanced(run.count, 1, run.first, 0);
+
+        graphics->CommandList()->SetPipelineState(pipelineState);
+        graphics->CommandList()->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_LINESTRIP);
+    }
+    else
+    {
+        graphics->CommandList()->IASetVertexBuffers(0, 1, finalCurve->VertexBufferView());
+        for (const Run& run : drawRuns)
+            graphics->CommandList()->DrawInstanced(run.count, 1, run.first, 0);
+    }
 
     // Desenhar os pontos de ancoragem
     graphics->CommandList()->IASetVertexBuffers(0, 1, squarePoint1->VertexBufferView());
@@ -602,6 +1190,13 @@ void Curves::Display()
     graphics->CommandList()->IASetVertexBuffers(0, 1, squarePoint4->VertexBufferView());
     graphics->CommandList()->DrawInstanced(MaxSquareVertex, 1, 0, 0);
 
+    // Desenhar o ponto destacado sob o cursor
+    if (hovering)
+    {
+        graphics->CommandList()->IASetVertexBuffers(0, 1, hoverPoint->VertexBufferView());
+        graphics->CommandList()->DrawInstanced(MaxSquareVertex, 1, 0, 0);
+    }
+
     // apresenta backbuffer
     graphics->Present();    
 }
@@ -612,14 +1207,17 @@ void Curves::Finalize()
 {
     rootSignature->Release();
     pipelineState->Release();
+    strokePipeline->Release();
     delete ctrlPoint1;
     delete ctrlPoint2;
     delete curve;
     delete finalCurve;
+    delete thickCurve;
     delete squarePoint1;
     delete squarePoint2;
     delete squarePoint3;
     delete squarePoint4;
+    delete hoverPoint;
 }
 
 // ------------------------------------------------------------------------------
@@ -750,6 +1348,12 @@ void Curves::BuildPipelineState()
     pso.SampleDesc.Quality = graphics->Quality();
     graphics->Device()->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&pipelineState));
 
+    // mesma configurao para os traos grossos, com tringulos preenchidos
+    rasterizer.FillMode = D3D12_FILL_MODE_SOLID;
+    pso.RasterizerState = rasterizer;
+    pso.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+    graphics->Device()->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&strokePipeline));
+
     vertexShader->Release();
     pixelShader->Release();
 }
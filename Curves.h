@@ -1,9 +1,21 @@
 #ifndef _CURVES_H
 
 #include "DXUT.h"
+#include "Intersection.h"
+#include "CurveFit.h"
+#include "History.h"
+#include "Snapshots.h"
+#include "FileTask.h"
+#include "Projector.h"
+#include "SceneIndex.h"
+#include "Polyline.h"
+#include "Stroke.h"
+#include "Frames.h"
 #include <cmath>
+#include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <sstream>
 using namespace std;
 
 struct Vertex
@@ -17,41 +29,84 @@ class Curves : public App
 private:
     ID3D12RootSignature* rootSignature;
     ID3D12PipelineState* pipelineState;
+    ID3D12PipelineState* strokePipeline;            // tringulos preenchidos para traos grossos
 
     Mesh* ctrlPoint1;
     Mesh* ctrlPoint2;
 
     Mesh* curve;
     Mesh* finalCurve;
+    Mesh* thickCurve;
 
     Mesh* squarePoint1;
     Mesh* squarePoint2;
     Mesh* squarePoint3;
     Mesh* squarePoint4;
+    Mesh* hoverPoint;
 
     static const uint MaxCtrl = 3;
-    static const uint MaxCurve = 1000;
+    static const uint MaxCurve = 5000;
     static const uint MaxSquareVertex = 5;
+    static const uint SegmentVertices = 50;
+    static const uint MaxStroke = 20 * MaxCurve;    // arena de vrtices dos traos grossos
+    static const uint StrokeGrain = 4096;           // vrtices por thread ao expandir os traos
+    static constexpr float StrokeError = 1.5f;      // erro do ajuste de traos em pixels
+    static constexpr float SnapRadius = 8.0f;       // alcance do cursor sobre as curvas em pixels
+    static constexpr float SimplifyError = 0.5f;    // desvio permitido na simplificao em pixels
 
     Vertex ctrl1[MaxCtrl];
     Vertex ctrl2[MaxCtrl];
 
     Vertex curvePoints[MaxCurve];
     Vertex showCurves[MaxCurve];
+    Vertex visibleCurves[MaxCurve];                 // trechos visveis enviados  GPU
 
     Vertex back1[MaxSquareVertex];
     Vertex back2[MaxSquareVertex];
     Vertex back3[MaxSquareVertex];
     Vertex back4[MaxSquareVertex];
 
+    SegmentList segments;
+    History history;
+    Snapshots snapshots;
+    FileTask fileTask;
+    uint fileProgress = 0;
+    SceneIndex scene;                               // caixas, splines, rvores e projeo
+    vector<Crossing> crossings;
+    vector<XMFLOAT3> stroke;
+    Projection hover;
+    bool hovering = false;
+    bool hoverDirty = true;
+    float hoverX = 0.0f;
+    float hoverY = 0.0f;
+
+    // faixa do buffer da GPU desenhada como uma LINESTRIP
+    struct Run
+    {
+        uint first;
+        uint count;
+    };
+
+    Box view = { -1.0f, -1.0f, 1.0f, 1.0f };       // janela visvel em coordenadas normalizadas
+    vector<bool> stale;                             // segmentos ainda no amostrados em showCurves
+    vector<Run> drawRuns;
+    bool drawDirty = true;
+    bool simplify = true;
+
+    Stroke::Style strokeStyle;
+    bool thick = false;                             // curvas finais desenhadas com espessura
+    vector<Vertex> strokeArena;                     // preenchida direto pela expanso
+    vector<float> strokeX;                          // posies visveis em SoA
+    vector<float> strokeY;
+    vector<Run> strokeRuns;                         // faixas de tringulos na arena
+
     uint ctrlCount1 = 0;
     uint ctrlCount2 = 0;
     uint index = 0;
     uint clickCount = 0;
     uint curveCount = 0;
     uint curveCount2 = 0;
-    uint curveIndex = 0;
-    uint totalCurves = 0;
+    uint curveIndex = 0;                            // posio em curvePoints (circular)
 
     bool newCurve = false;
     bool createCurve = false;
@@ -76,10 +131,24 @@ public:
     void DrawVertices();
 
     void CreateCurve();
+    void CreateStroke();
+    void StoreSegments(const Segment* items, uint n);
+    void Tessellate(const Segment& s, Vertex* out) const;
+    void AddSegments(const Segment* items, uint n);
+    void BuildSceneIndex();
+    void ResetScene();
+    void UpdateHover();
+    void ShowVersion();
     void SaveCurve();
     void LoadCurve();
+    void PollFile();
+    void WriteState(ostream& fout);
+    void ReadState(istream& fin);
     void DeleteCurve();
+    void Undo();
+    void Redo();
     void DrawCurve();
+    void ExpandStrokes(uint count);
 
     void DrawSquares();
 
@@ -0,0 +1,262 @@
+/**********************************************************************************
+// FileTask (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Gravao e leitura da cena em segundo plano, com progresso,
+//              cancelamento e substituio atmica do arquivo gravado
+//
+**********************************************************************************/
+
+#include "FileTask.h"
+#include <fstream>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    const uint BlockSegments = 4096;        // segmentos lidos por vez
+}
+
+// ------------------------------------------------------------------------------
+
+FileTask::~FileTask()
+{
+    Cancel();
+    if (worker.joinable())
+        worker.join();
+}
+
+// ------------------------------------------------------------------------------
+
+void FileTask::Start()
+{
+    if (worker.joinable())
+        worker.join();
+
+    cancel.store(false);
+    done.store(0);
+    total.store(0);
+    state.store(Running);
+}
+
+// ------------------------------------------------------------------------------
+
+bool FileTask::Save(const string& path, const string& state, Snapshots& scene)
+{
+    if (Busy())
+        return false;
+
+    Start();
+    saving = true;
+    header = state;
+    source = &scene;
+    segments = SegmentList();
+    legacy = false;
+
+    worker = thread(&FileTask::RunSave, this, path);
+    return true;
+}
+
+// ------------------------------------------------------------------------------
+
+bool FileTask::Load(const string& path)
+{
+    if (Busy())
+        return false;
+
+    Start();
+    saving = false;
+    header.clear();
+    segments = SegmentList();
+    index.Clear();
+    legacy = false;
+
+    worker = thread(&FileTask::RunLoad, this, path);
+    return true;
+}
+
+// ------------------------------------------------------------------------------
+
+FileTask::State FileTask::Poll()
+{
+    State s = State(state.load(memory_order_acquire));
+
+    if (s != Running && worker.joinable())
+        worker.join();
+
+    return s;
+}
+
+// ------------------------------------------------------------------------------
+
+float FileTask::Progress() const
+{
+    unsigned long long t = total.load();
+    return t > 0 ? float(double(done.load()) / double(t)) : 0.0f;
+}
+
+// ------------------------------------------------------------------------------
+
+void FileTask::Reset()
+{
+    if (Busy())
+        return;
+
+    if (worker.joinable())
+        worker.join();
+
+    header.clear();
+    segments = SegmentList();
+    index.Clear();
+    state.store(Idle);
+}
+
+// ------------------------------------------------------------------------------
+
+// Grava em um arquivo temporrio e s ento substitui o arquivo final,
+// de modo que uma falha ou um cancelamento nunca deixem o arquivo pela metade
+void FileTask::RunSave(string path)
+{
+    // a verso gravada  a publicada mais recente; a cpia a mantm
+    // viva depois da leitura, sem travar o escritor
+    uint reader = source->Register();
+    bool read = source->Read(reader, [&](const Snapshot& snapshot) { segments = snapshot.segments; });
+    source->Unregister(reader);
+
+    if (!read)
+    {
+        state.store(Failed, memory_order_release);
+        return;
+    }
+
+    string temp = path + ".tmp";
+    uint count = segments.Size();
+    uint size = uint(header.size());
+
+    total.store(header.size() + (unsigned long long)count * sizeof(Segment));
+
+    uint signature = Signature;
+    ofstream fout(temp, ios::binary | ios::trunc);
+    bool ok = fout.is_open();
+
+    if (ok)
+    {
+        fout.write((char*)&signature, sizeof(signature));
+        fout.write((char*)&size, sizeof(size));
+        fout.write(header.data(), size);
+        fout.write((char*)&count, sizeof(count));
+        done.store(size);
+
+        segments.ForEachBlock([&](const Segment* items, uint, uint n)
+        {
+            if (!ok || cancel.load())
+                return;
+
+            fout.write((char*)items, n * sizeof(Segment));
+            done.fetch_add(n * sizeof(Segment));
+            ok = fout.good();
+        });
+
+        fout.close();
+        ok = ok && !fout.fail();
+    }
+
+    if (cancel.load())
+    {
+        DeleteFile(temp.c_str());
+        state.store(Canceled, memory_order_release);
+    }
+    else if (ok && MoveFileEx(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+    {
+        state.store(Done, memory_order_release);
+    }
+    else
+    {
+        DeleteFile(temp.c_str());
+        state.store(Failed, memory_order_release);
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+void FileTask::RunLoad(string path)
+{
+    ifstream fin(path, ios::binary | ios::ate);
+
+    if (!fin.is_open())
+    {
+        state.store(Failed, memory_order_release);
+        return;
+    }
+
+    total.store((unsigned long long)fin.tellg());
+    fin.seekg(0);
+
+    uint signature = 0;
+    uint size = 0;
+    fin.read((char*)&signature, sizeof(signature));
+
+    if (!fin || signature != Signature)
+    {
+        // formato antigo: o arquivo inteiro  o bloco de estado
+        legacy = true;
+        fin.clear();
+        fin.seekg(0);
+        header.assign(istreambuf_iterator<char>(fin), istreambuf_iterator<char>());
+        done.store(total.load());
+        state.store(Done, memory_order_release);
+        return;
+    }
+
+    fin.read((char*)&size, sizeof(size));
+    if (!fin || size > total.load())
+    {
+        state.store(Failed, memory_order_release);
+        return;
+    }
+
+    header.resize(size);
+    fin.read(&header[0], size);
+
+    uint count = 0;
+    fin.read((char*)&count, sizeof(count));
+    done.store((unsigned long long)fin.tellg());
+
+    // os segmentos entram em blocos inteiros na lista persistente
+    vector<Segment> block(BlockSegments);
+    SegmentList loaded;
+
+    while (fin && loaded.Size() < count && !cancel.load())
+    {
+        uint n = min(BlockSegments, count - loaded.Size());
+        if (!fin.read((char*)block.data(), n * sizeof(Segment)))
+            break;
+
+        loaded = loaded.Append(block.data(), n);
+        done.fetch_add(n * sizeof(Segment));
+    }
+
+    if (cancel.load())
+    {
+        state.store(Canceled, memory_order_release);
+    }
+    else if (!fin || loaded.Size() != count)
+    {
+        state.store(Failed, memory_order_release);
+    }
+    else
+    {
+        // o ndice tambm  montado aqui, fora da thread da interface
+        segments = loaded;
+        index.Build(segments);
+        state.store(Done, memory_order_release);
+    }
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,94 @@
+/**********************************************************************************
+// FileTask (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Gravao e leitura da cena em segundo plano, com progresso,
+//              cancelamento e substituio atmica do arquivo gravado
+//
+**********************************************************************************/
+
+#ifndef _FILETASK_H_
+#define _FILETASK_H_
+
+#include "SegmentList.h"
+#include "Snapshots.h"
+#include "SceneIndex.h"
+#include <atomic>
+#include <thread>
+#include <string>
+using std::atomic;
+using std::thread;
+using std::string;
+
+// ------------------------------------------------------------------------------
+
+// Formato do arquivo: assinatura, tamanho do bloco de estado, bloco de
+// estado (gravado por Curves), quantidade de segmentos e segmentos.
+// Arquivos sem a assinatura so do formato antigo e contm s o estado.
+class FileTask
+{
+public:
+    enum State { Idle, Running, Done, Failed, Canceled };
+
+    static const uint Signature = 0x32565243;       // "CRV2"
+
+private:
+    thread worker;
+    atomic<int> state { Idle };
+    atomic<bool> cancel { false };
+    atomic<unsigned long long> done { 0 };
+    atomic<unsigned long long> total { 0 };
+
+    bool saving = false;
+    Snapshots* source = nullptr;    // verses publicadas, lidas pela gravao
+    string header;                  // bloco de estado gravado ou lido
+    SegmentList segments;           // segmentos gravados ou lidos
+    SceneIndex index;               // ndice dos segmentos lidos, montado na leitura
+    bool legacy = false;            // arquivo lido no formato antigo
+
+    void RunSave(string path);
+    void RunLoad(string path);
+    void Start();
+
+public:
+    ~FileTask();
+
+    // inicia a gravao de uma cpia do estado e da verso mais recente
+    // publicada em scene, lida pela prpria thread de gravao (scene deve
+    // existir at a tarefa terminar); retorna false se outra tarefa estiver
+    // em andamento
+    bool Save(const string& path, const string& state, Snapshots& scene);
+
+    // inicia a leitura; o resultado fica disponvel quando Poll retornar Done
+    bool Load(const string& path);
+
+    // sem bloquear: estado da tarefa (encerra a thread quando ela termina)
+    State Poll();
+
+    // pede o cancelamento; a tarefa termina com Canceled
+    void Cancel() { cancel.store(true); }
+
+    bool Busy() const { return state.load() == Running; }
+    bool Saving() const { return saving; }
+
+    // frao concluda entre 0 e 1
+    float Progress() const;
+
+    // resultado de uma leitura concluda
+    const string& Header() const { return header; }
+    const SegmentList& Segments() const { return segments; }
+
+    // ndice de Segments(); quem o usa pode troc-lo pelo seu (swap)
+    SceneIndex& Index() { return index; }
+    bool Legacy() const { return legacy; }
+
+    // volta ao estado ocioso e libera o resultado
+    void Reset();
+};
+
+// ------------------------------------------------------------------------------
+
+#endif
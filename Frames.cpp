@@ -0,0 +1,252 @@
+/**********************************************************************************
+// Frames (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Avaliao conjunta de posio, tangente, normal e curvatura
+//              ao longo de um segmento, em vetores separados por campo
+//
+**********************************************************************************/
+
+#include "Frames.h"
+#include <xmmintrin.h>
+#include <cmath>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    const float Degenerate = 1e-6f;         // derivada menor que isso no define direo
+
+    // Pontos de controle da curva e de suas derivadas (hodgrafas) na base
+    // de Bernstein. Nessa forma a derivada numa ncora  a diferena exata
+    // dos pontos, e um ponto de apoio sobre a ncora d derivada zero.
+    struct Hodograph
+    {
+        float px[4], py[4];                 // B
+        float dx[3], dy[3];                 // B' / 3
+        float ex[2], ey[2];                 // B'' / 6
+    };
+
+    Hodograph Differences(const Segment& s)
+    {
+        Hodograph h;
+
+        for (uint k = 0; k < 4; ++k)
+        {
+            h.px[k] = s.P[k].x;
+            h.py[k] = s.P[k].y;
+        }
+
+        for (uint k = 0; k < 3; ++k)
+        {
+            h.dx[k] = h.px[k + 1] - h.px[k];
+            h.dy[k] = h.py[k + 1] - h.py[k];
+        }
+
+        for (uint k = 0; k < 2; ++k)
+        {
+            h.ex[k] = h.dx[k + 1] - h.dx[k];
+            h.ey[k] = h.dy[k + 1] - h.dy[k];
+        }
+
+        return h;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Uma amostra escalar: usada no fim dos vetores e onde a derivada se anula
+    void Single(Frames& f, uint i, const Hodograph& h, float t)
+    {
+        float u = 1.0f - t;
+        float uu = u * u, ut = u * t, tt = t * t;
+
+        float dx = uu * h.dx[0] + 2.0f * ut * h.dx[1] + tt * h.dx[2];
+        float dy = uu * h.dy[0] + 2.0f * ut * h.dy[1] + tt * h.dy[2];
+        float ex = u * h.ex[0] + t * h.ex[1];
+        float ey = u * h.ey[0] + t * h.ey[1];
+        float len = sqrt(dx * dx + dy * dy);
+
+        f.x[i] = u * uu * h.px[0] + 3.0f * uu * t * h.px[1] + 3.0f * u * tt * h.px[2] + t * tt * h.px[3];
+        f.y[i] = u * uu * h.py[0] + 3.0f * uu * t * h.py[1] + 3.0f * u * tt * h.py[2] + t * tt * h.py[3];
+        f.speed[i] = 3.0f * len;
+        f.curvature[i] = 0.0f;
+
+        float ux = 1.0f, uy = 0.0f;
+
+        if (3.0f * len >= Degenerate)
+        {
+            // (B' x B'') / |B'| com B' = 3d e B'' = 6e
+            ux = dx / len;
+            uy = dy / len;
+            f.curvature[i] = (2.0f / 3.0f) * (dx * ey - dy * ex) / (len * len * len);
+        }
+        else
+        {
+            // derivada nula (ponto de apoio sobre a ncora ou cspide): a direo
+            // vem do prximo termo de Taylor que no se anula; a curva sai de t
+            // por +B'', mas no fim do segmento chega por -B''
+            float sign = t < 1.0f ? 1.0f : -1.0f;
+            float el = sqrt(ex * ex + ey * ey);
+
+            if (el >= Degenerate)
+            {
+                ux = sign * ex / el;
+                uy = sign * ey / el;
+            }
+            else
+            {
+                // terceira derivada, constante no segmento
+                float gx = h.ex[1] - h.ex[0];
+                float gy = h.ey[1] - h.ey[0];
+                float gl = sqrt(gx * gx + gy * gy);
+
+                if (gl >= Degenerate)
+                {
+                    ux = gx / gl;
+                    uy = gy / gl;
+                }
+            }
+        }
+
+        f.tx[i] = ux;
+        f.ty[i] = uy;
+        f.nx[i] = -uy;
+        f.ny[i] = ux;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Quatro amostras por vez (uma por raia), a partir da posio i. Curva e
+    // derivadas compartilham os termos u, ut e t da base; raias com
+    // derivada nula so refeitas pelo caminho escalar.
+    void Block(Frames& f, uint i, const Hodograph& h, __m128 t)
+    {
+        const __m128 three = _mm_set1_ps(3.0f);
+
+        __m128 u = _mm_sub_ps(_mm_set1_ps(1.0f), t);
+        __m128 uu = _mm_mul_ps(u, u);
+        __m128 ut = _mm_mul_ps(u, t);
+        __m128 tt = _mm_mul_ps(t, t);
+
+        // pesos da curva (u, 3ut, 3ut, t) e da primeira derivada (u, 2ut, t)
+        __m128 b0 = _mm_mul_ps(uu, u);
+        __m128 b1 = _mm_mul_ps(three, _mm_mul_ps(uu, t));
+        __m128 b2 = _mm_mul_ps(three, _mm_mul_ps(ut, t));
+        __m128 b3 = _mm_mul_ps(tt, t);
+        __m128 ut2 = _mm_add_ps(ut, ut);
+
+        auto curve = [&](const float* p)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(b0, _mm_set1_ps(p[0])), _mm_mul_ps(b1, _mm_set1_ps(p[1]))),
+                              _mm_add_ps(_mm_mul_ps(b2, _mm_set1_ps(p[2])), _mm_mul_ps(b3, _mm_set1_ps(p[3]))));
+        };
+
+        auto first = [&](const float* d)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(uu, _mm_set1_ps(d[0])), _mm_mul_ps(ut2, _mm_set1_ps(d[1]))),
+                              _mm_mul_ps(tt, _mm_set1_ps(d[2])));
+        };
+
+        auto second = [&](const float* e)
+        {
+            return _mm_add_ps(_mm_mul_ps(u, _mm_set1_ps(e[0])), _mm_mul_ps(t, _mm_set1_ps(e[1])));
+        };
+
+        __m128 px = curve(h.px), py = curve(h.py);
+        __m128 dx = first(h.dx), dy = first(h.dy);
+        __m128 ex = second(h.ex), ey = second(h.ey);
+
+        __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        __m128 speed = _mm_mul_ps(three, len);
+        __m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), len);
+        __m128 ux = _mm_mul_ps(dx, inv);
+        __m128 uy = _mm_mul_ps(dy, inv);
+        __m128 cross = _mm_sub_ps(_mm_mul_ps(dx, ey), _mm_mul_ps(dy, ex));
+        __m128 k = _mm_mul_ps(_mm_set1_ps(2.0f / 3.0f), _mm_mul_ps(cross, _mm_mul_ps(inv, _mm_mul_ps(inv, inv))));
+
+        _mm_storeu_ps(&f.x[i], px);
+        _mm_storeu_ps(&f.y[i], py);
+        _mm_storeu_ps(&f.tx[i], ux);
+        _mm_storeu_ps(&f.ty[i], uy);
+        _mm_storeu_ps(&f.nx[i], _mm_sub_ps(_mm_setzero_ps(), uy));
+        _mm_storeu_ps(&f.ny[i], ux);
+        _mm_storeu_ps(&f.curvature[i], k);
+        _mm_storeu_ps(&f.speed[i], speed);
+
+        int degenerate = _mm_movemask_ps(_mm_cmplt_ps(speed, _mm_set1_ps(Degenerate)));
+        if (degenerate)
+        {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, t);
+
+            for (uint j = 0; j < 4; ++j)
+                if (degenerate & (1 << j))
+                    Single(f, i + j, h, lanes[j]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+void Frames::Resize(uint count)
+{
+    x.resize(count);
+    y.resize(count);
+    tx.resize(count);
+    ty.resize(count);
+    nx.resize(count);
+    ny.resize(count);
+    curvature.resize(count);
+    speed.resize(count);
+}
+
+// ------------------------------------------------------------------------------
+
+void Frames::Evaluate(const Segment& s, uint first, uint count)
+{
+    if (count == 0)
+        return;
+
+    if (Size() < first + count)
+        Resize(first + count);
+
+    const Hodograph h = Differences(s);
+
+    // t = k / (count - 1) por diviso, para que a ltima amostra caia em 1
+    const float last = count > 1 ? float(count - 1) : 1.0f;
+    const __m128 lane = _mm_set_ps(3.0f, 2.0f, 1.0f, 0.0f);
+    const __m128 div = _mm_set1_ps(last);
+
+    uint k = 0;
+    for (; k + 4 <= count; k += 4)
+        Block(*this, first + k, h, _mm_div_ps(_mm_add_ps(_mm_set1_ps(float(k)), lane), div));
+
+    for (; k < count; ++k)
+        Single(*this, first + k, h, k / last);
+}
+
+// ------------------------------------------------------------------------------
+
+void Frames::Evaluate(const Segment& s, const float* t, uint first, uint count)
+{
+    if (count == 0)
+        return;
+
+    if (Size() < first + count)
+        Resize(first + count);
+
+    const Hodograph h = Differences(s);
+
+    uint k = 0;
+    for (; k + 4 <= count; k += 4)
+        Block(*this, first + k, h, _mm_loadu_ps(t + k));
+
+    for (; k < count; ++k)
+        Single(*this, first + k, h, t[k]);
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,48 @@
+/**********************************************************************************
+// Frames (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Avaliao conjunta de posio, tangente, normal e curvatura
+//              ao longo de um segmento, em vetores separados por campo
+//
+**********************************************************************************/
+
+#ifndef _FRAMES_H_
+#define _FRAMES_H_
+
+#include "Bezier.h"
+#include <vector>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Amostras de uma curva em SoA: a amostra i ocupa a posio i de cada vetor.
+// Posio, primeira e segunda derivadas saem da mesma passada pela base de
+// Bernstein, de modo que deslocamentos, orientao de objetos ao longo do
+// caminho e nvel de detalhe por curvatura no precisam reavaliar a curva.
+// As medidas valem nas coordenadas dos pontos de controle; para obt-las em
+// pixels basta escalar o segmento antes (a curva acompanha a transformao).
+struct Frames
+{
+    vector<float> x, y;             // posio
+    vector<float> tx, ty;           // tangente unitria
+    vector<float> nx, ny;           // normal unitria,  esquerda da tangente
+    vector<float> curvature;        // curvatura com sinal (positiva girando  esquerda)
+    vector<float> speed;            // mdulo da primeira derivada
+
+    void Resize(uint count);
+    uint Size() const { return uint(x.size()); }
+
+    // avalia s em count parmetros uniformes de 0 a 1, a partir da amostra first
+    void Evaluate(const Segment& s, uint first, uint count);
+
+    // avalia s nos parmetros t[0..count), a partir da amostra first
+    void Evaluate(const Segment& s, const float* t, uint first, uint count);
+};
+
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,53 @@
+/**********************************************************************************
+// History (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Histrico de desfazer/refazer sobre verses da SegmentList
+//
+**********************************************************************************/
+
+#include "History.h"
+
+// ------------------------------------------------------------------------------
+
+void History::Commit(const SegmentList& version)
+{
+    versions.resize(current + 1);
+    versions.push_back(version);
+    ++current;
+}
+
+// ------------------------------------------------------------------------------
+
+void History::Reset(const SegmentList& version)
+{
+    versions.assign(1, version);
+    current = 0;
+}
+
+// ------------------------------------------------------------------------------
+
+bool History::Undo()
+{
+    if (!CanUndo())
+        return false;
+
+    --current;
+    return true;
+}
+
+// ------------------------------------------------------------------------------
+
+bool History::Redo()
+{
+    if (!CanRedo())
+        return false;
+
+    ++current;
+    return true;
+}
+
+// ------------------------------------------------------------------------------
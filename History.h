@@ -0,0 +1,50 @@
+/**********************************************************************************
+// History (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Histrico de desfazer/refazer sobre verses da SegmentList
+//
+**********************************************************************************/
+
+#ifndef _HISTORY_H_
+#define _HISTORY_H_
+
+#include "SegmentList.h"
+#include <vector>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Guarda as verses da cena em sequncia. Como as verses compartilham os
+// blocos no alterados, cada edio custa apenas os blocos que ela mudou,
+// e desfazer ou refazer  s mover o ndice da verso atual.
+class History
+{
+private:
+    vector<SegmentList> versions;
+    uint current = 0;
+
+public:
+    History() : versions(1) {}
+
+    const SegmentList& Current() const { return versions[current]; }
+
+    // registra uma nova verso e descarta as que podiam ser refeitas
+    void Commit(const SegmentList& version);
+
+    // volta ao estado inicial, sem histrico
+    void Reset(const SegmentList& version = SegmentList());
+
+    bool CanUndo() const { return current > 0; }
+    bool CanRedo() const { return current + 1 < versions.size(); }
+
+    bool Undo();
+    bool Redo();
+};
+
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,584 @@
+/**********************************************************************************
+// Intersection (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Intersees curva-curva e curva-reta por subdiviso com
+//              recorte de caixas e fase ampla sobre uma BoxTree
+//
+**********************************************************************************/
+
+#include "Intersection.h"
+#include <cmath>
+#include <algorithm>
+#include <cfloat>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    const uint MaxDepth  = 40;          // limite de subdivises por par
+    const uint MaxLeaves = 4096;        // oramento de folhas por par de curvas
+    const float MergeGap = 1e-3f;       // distncia paramtrica para agrupar resultados
+    const float Converged = 1e-2f;      // frao de tol considerada uma raiz exata
+
+    // trecho de curva com o intervalo paramtrico que ele representa
+    struct Piece
+    {
+        Segment s;
+        float t0, t1;
+    };
+
+    // -------------------------------------------------------------------------
+
+    float Cross(float ax, float ay, float bx, float by)
+    {
+        return ax * by - ay * bx;
+    }
+
+    float Distance(const XMFLOAT3& a, const XMFLOAT3& b)
+    {
+        return hypot(a.x - b.x, a.y - b.y);
+    }
+
+    Box Inflate(Box box, float d)
+    {
+        box.minX -= d; box.minY -= d;
+        box.maxX += d; box.maxY += d;
+        return box;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Teste de linha gorda: a curva a fica dentro de uma faixa paralela 
+    // sua corda; se todos os pontos de controle de b esto fora dessa faixa
+    // (do mesmo lado), as curvas no se tocam
+    bool FatLineReject(const Segment& a, const Segment& b, float tol)
+    {
+        float dx = a.P[3].x - a.P[0].x;
+        float dy = a.P[3].y - a.P[0].y;
+        float len = sqrt(dx * dx + dy * dy);
+
+        if (len < 1e-12f)
+            return false;
+
+        auto dist = [&](const XMFLOAT3& p) { return Cross(dx, dy, p.x - a.P[0].x, p.y - a.P[0].y) / len; };
+
+        float d1 = dist(a.P[1]);
+        float d2 = dist(a.P[2]);
+        float dmin = min(0.0f, min(d1, d2)) - tol;
+        float dmax = max(0.0f, max(d1, d2)) + tol;
+
+        bool below = true;
+        bool above = true;
+        for (int i = 0; i < 4; ++i)
+        {
+            float d = dist(b.P[i]);
+            below = below && d < dmin;
+            above = above && d > dmax;
+        }
+
+        return below || above;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Distncia do ponto p ao segmento a-b e parmetro do ponto mais prximo
+    float PointSegment(const XMFLOAT3& p, const XMFLOAT3& a, const XMFLOAT3& b, float& s)
+    {
+        float dx = b.x - a.x, dy = b.y - a.y;
+        float len2 = dx * dx + dy * dy;
+        s = len2 > 0.0f ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / len2 : 0.0f;
+        s = min(1.0f, max(0.0f, s));
+        return hypot(a.x + s * dx - p.x, a.y + s * dy - p.y);
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Refina (t, u) por Newton em A(t) - B(u) = 0 sem sair dos intervalos
+    // dos trechos. A planicidade s limita o desvio perpendicular  corda,
+    // ento o parmetro lido na corda pode estar longe do real. Um passo
+    // s  aceito se aproximar os pontos; perto da tangncia o sistema 
+    // quase singular e o amortecimento evita deslizar ao longo das curvas.
+    // Retorna a distncia final entre os pontos.
+    float Polish(const Segment& A, const Segment& B, const Piece& a, const Piece& b, float& t, float& u)
+    {
+        XMFLOAT3 p = Bezier::Point(A, t);
+        XMFLOAT3 q = Bezier::Point(B, u);
+        float gap = Distance(p, q);
+
+        for (int it = 0; it < 3 && gap > 0.0f; ++it)
+        {
+            XMFLOAT3 da = Bezier::Derivative(A, t);
+            XMFLOAT3 db = Bezier::Derivative(B, u);
+            float fx = p.x - q.x, fy = p.y - q.y;
+
+            // (J^T J + mu I) d = -J^T f, com J = [A'(t), -B'(u)]
+            float aa = da.x * da.x + da.y * da.y;
+            float bb = db.x * db.x + db.y * db.y;
+            float ab = -(da.x * db.x + da.y * db.y);
+            float mu = 1e-6f * (aa + bb);
+            float ga = da.x * fx + da.y * fy;
+            float gb = -(db.x * fx + db.y * fy);
+            float det = (aa + mu) * (bb + mu) - ab * ab;
+
+            if (!(det > 0.0f))
+                break;
+
+            float nt = min(a.t1, max(a.t0, t - ((bb + mu) * ga - ab * gb) / det));
+            float nu = min(b.t1, max(b.t0, u - ((aa + mu) * gb - ab * ga) / det));
+
+            XMFLOAT3 np = Bezier::Point(A, nt);
+            XMFLOAT3 nq = Bezier::Point(B, nu);
+            float ngap = Distance(np, nq);
+
+            if (ngap >= gap)
+                break;
+
+            t = nt; u = nu;
+            p = np; q = nq;
+            gap = ngap;
+        }
+
+        return gap;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Resolve as cordas de dois trechos j retos; A e B so as curvas inteiras
+    void Leaf(const Segment& A, const Segment& B, const Piece& a, const Piece& b, float tol, vector<Hit>& raw)
+    {
+        const XMFLOAT3& a0 = a.s.P[0];
+        const XMFLOAT3& a1 = a.s.P[3];
+        const XMFLOAT3& b0 = b.s.P[0];
+        const XMFLOAT3& b1 = b.s.P[3];
+
+        float dax = a1.x - a0.x, day = a1.y - a0.y;
+        float dbx = b1.x - b0.x, dby = b1.y - b0.y;
+        float ox  = b0.x - a0.x, oy  = b0.y - a0.y;
+        float den = Cross(dax, day, dbx, dby);
+
+        auto emit = [&](float s, float v)
+        {
+            s = min(1.0f, max(0.0f, s));
+            v = min(1.0f, max(0.0f, v));
+
+            float t = a.t0 + s * (a.t1 - a.t0);
+            float u = b.t0 + v * (b.t1 - b.t0);
+            float gap = Polish(A, B, a, b, t, u);
+
+            // parado na fronteira interna de um trecho sem convergir: a raiz
+            // est no trecho vizinho, que a encontra por conta prpria
+            bool edge = (t == a.t0 && a.t0 > 0.0f) || (t == a.t1 && a.t1 < 1.0f)
+                     || (u == b.t0 && b.t0 > 0.0f) || (u == b.t1 && b.t1 < 1.0f);
+
+            if (!edge || gap <= Converged * tol)
+                raw.push_back({ t, u, false });
+        };
+
+        // cordas transversais que se cruzam
+        if (den != 0.0f)
+        {
+            float s = Cross(ox, oy, dbx, dby) / den;
+            float v = Cross(ox, oy, dax, day) / den;
+
+            if (s >= 0.0f && s <= 1.0f && v >= 0.0f && v <= 1.0f)
+            {
+                emit(s, v);
+                return;
+            }
+        }
+
+        // tangncia ou quase-toque: par de pontos mais prximos das cordas
+        float s, v, best;
+        float sa = 0.0f, va = 0.0f;
+
+        best = PointSegment(a0, b0, b1, v);  sa = 0.0f; va = v;
+        float d = PointSegment(a1, b0, b1, v);
+        if (d < best) { best = d; sa = 1.0f; va = v; }
+        d = PointSegment(b0, a0, a1, s);
+        if (d < best) { best = d; sa = s; va = 0.0f; }
+        d = PointSegment(b1, a0, a1, s);
+        if (d < best) { best = d; sa = s; va = 1.0f; }
+
+        if (best <= tol)
+            emit(sa, va);
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Parmetro em que o ponto p est sobre a curva, se estiver a menos de tol
+    bool Locate(const Segment& s, const XMFLOAT3& p, float tol, float& t)
+    {
+        if (!Bezier::Overlap(Inflate(Bezier::Hull(s), tol), { p.x, p.y, p.x, p.y }))
+            return false;
+
+        const int Samples = 16;
+        float best = FLT_MAX;
+
+        for (int i = 0; i <= Samples; ++i)
+        {
+            float ti = i / float(Samples);
+            float d = Distance(Bezier::Point(s, ti), p);
+            if (d < best)
+            {
+                best = d;
+                t = ti;
+            }
+        }
+
+        // Newton sobre a derivada da distncia ao quadrado
+        for (int it = 0; it < 8; ++it)
+        {
+            XMFLOAT3 q  = Bezier::Point(s, t);
+            XMFLOAT3 d1 = Bezier::Derivative(s, t);
+            XMFLOAT3 d2 = Bezier::SecondDerivative(s, t);
+
+            float f  = (q.x - p.x) * d1.x + (q.y - p.y) * d1.y;
+            float df = d1.x * d1.x + d1.y * d1.y + (q.x - p.x) * d2.x + (q.y - p.y) * d2.y;
+
+            if (df <= 0.0f)
+                break;
+
+            t = min(1.0f, max(0.0f, t - f / df));
+        }
+
+        return Distance(Bezier::Point(s, t), p) <= tol;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Curvas coincidentes num trecho: as extremidades de uma caem sobre a
+    // outra e os trechos comuns coincidem (mesmos pontos de controle, ou
+    // duas retas com parametrizaes diferentes). Nesse caso a subdiviso
+    // no termina, ento o trecho  tratado  parte.
+    bool Coincident(const Segment& a, const Segment& b, float tol, vector<Hit>& hits)
+    {
+        Hit ends[4];
+        uint n = 0;
+        float t;
+
+        for (int i = 0; i < 4; i += 3)
+        {
+            if (Locate(b, a.P[i], tol, t))
+                ends[n++] = { i / 3.0f, t, true };
+            if (Locate(a, b.P[i], tol, t))
+                ends[n++] = { t, i / 3.0f, true };
+        }
+
+        if (n < 2)
+            return false;
+
+        sort(ends, ends + n, [](const Hit& x, const Hit& y) { return x.t < y.t; });
+        const Hit& first = ends[0];
+        const Hit& last = ends[n - 1];
+
+        Segment sa = Bezier::Sub(a, first.t, last.t);
+        Segment sb = Bezier::Sub(b, first.u, last.u);
+
+        if (Distance(sa.P[0], sa.P[3]) <= tol)
+            return false;
+
+        if (Bezier::Flatness(sa) <= tol && Bezier::Flatness(sb) <= tol)
+        {
+            // retas: basta o ponto mdio de um trecho estar sobre o outro
+            if (!Locate(sb, Bezier::Point(sa, 0.5f), tol, t))
+                return false;
+        }
+        else
+        {
+            for (int i = 0; i < 4; ++i)
+                if (Distance(sa.P[i], sb.P[i]) > tol)
+                    return false;
+        }
+
+        hits.push_back(first);
+        hits.push_back(last);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+
+    void Clip(const Segment& A, const Segment& B, const Piece& a, const Piece& b, uint depth, float tol,
+              vector<Hit>& raw, uint& budget)
+    {
+        if (budget == 0)
+            return;
+
+        if (!Bezier::Overlap(Inflate(Bezier::Hull(a.s), tol), Bezier::Hull(b.s)))
+            return;
+
+        if (FatLineReject(a.s, b.s, tol) || FatLineReject(b.s, a.s, tol))
+            return;
+
+        float fa = Bezier::Flatness(a.s);
+        float fb = Bezier::Flatness(b.s);
+
+        if ((fa <= tol && fb <= tol) || depth >= MaxDepth)
+        {
+            --budget;
+            Leaf(A, B, a, b, tol, raw);
+            return;
+        }
+
+        // divide o trecho menos reto e continua com as duas metades
+        Piece l, r;
+        if (fa >= fb)
+        {
+            float tm = 0.5f * (a.t0 + a.t1);
+            Bezier::Split(a.s, 0.5f, l.s, r.s);
+            l.t0 = a.t0; l.t1 = tm;
+            r.t0 = tm;   r.t1 = a.t1;
+            Clip(A, B, l, b, depth + 1, tol, raw, budget);
+            Clip(A, B, r, b, depth + 1, tol, raw, budget);
+        }
+        else
+        {
+            float tm = 0.5f * (b.t0 + b.t1);
+            Bezier::Split(b.s, 0.5f, l.s, r.s);
+            l.t0 = b.t0; l.t1 = tm;
+            r.t0 = tm;   r.t1 = b.t1;
+            Clip(A, B, a, l, depth + 1, tol, raw, budget);
+            Clip(A, B, a, r, depth + 1, tol, raw, budget);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Agrupa resultados vizinhos: uma tangncia ou um cruzamento perto da
+    // fronteira entre trechos aparece em vrias folhas; de cada grupo fica
+    // o membro em que os dois objetos esto mais prximos
+    template<class Gap>
+    void Merge(vector<Hit>& raw, vector<Hit>& hits, Gap gap)
+    {
+        sort(raw.begin(), raw.end(), [](const Hit& x, const Hit& y) { return x.t < y.t; });
+
+        size_t i = 0;
+        while (i < raw.size())
+        {
+            size_t best = i;
+            float bestGap = gap(raw[i]);
+            size_t j = i + 1;
+
+            while (j < raw.size() && raw[j].t - raw[j - 1].t <= MergeGap && fabs(raw[j].u - raw[j - 1].u) <= MergeGap)
+            {
+                float g = gap(raw[j]);
+                if (g < bestGap)
+                {
+                    bestGap = g;
+                    best = j;
+                }
+                ++j;
+            }
+
+            hits.push_back(raw[best]);
+            i = j;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Razes reais de c3 t + c2 t + c1 t + c0 no intervalo [0,1]
+    uint SolveCubic(double c3, double c2, double c1, double c0, float* roots)
+    {
+        const double eps = 1e-6;
+        double r[3];
+        uint n = 0;
+
+        double scale = max(max(fabs(c3), fabs(c2)), max(fabs(c1), fabs(c0)));
+        if (scale == 0.0)
+            return 0;
+
+        if (fabs(c3) < 1e-9 * scale)
+        {
+            // quadrtica ou linear
+            if (fabs(c2) < 1e-9 * scale)
+            {
+                if (fabs(c1) > 0.0)
+                    r[n++] = -c0 / c1;
+            }
+            else
+            {
+                double disc = c1 * c1 - 4.0 * c2 * c0;
+                if (disc >= 0.0)
+                {
+                    double q = -0.5 * (c1 + (c1 >= 0 ? sqrt(disc) : -sqrt(disc)));
+                    r[n++] = q / c2;
+                    if (q != 0.0)
+                        r[n++] = c0 / q;
+                }
+            }
+        }
+        else
+        {
+            // forma reduzida de Cardano
+            double a = c2 / c3, b = c1 / c3, c = c0 / c3;
+            double p = b - a * a / 3.0;
+            double q = 2.0 * a * a * a / 27.0 - a * b / 3.0 + c;
+            double disc = q * q / 4.0 + p * p * p / 27.0;
+            double shift = -a / 3.0;
+
+            if (disc > 0.0)
+            {
+                double sq = sqrt(disc);
+                r[n++] = cbrt(-q / 2.0 + sq) + cbrt(-q / 2.0 - sq) + shift;
+            }
+            else if (p == 0.0)
+            {
+                r[n++] = shift;
+            }
+            else
+            {
+                double m = 2.0 * sqrt(-p / 3.0);
+                double theta = acos(max(-1.0, min(1.0, 3.0 * q / (p * m)))) / 3.0;
+                for (int k = 0; k < 3; ++k)
+                    r[n++] = m * cos(theta - 2.0 * 3.14159265358979323846 * k / 3.0) + shift;
+            }
+        }
+
+        uint count = 0;
+        for (uint k = 0; k < n; ++k)
+        {
+            // polimento por Newton
+            double t = r[k];
+            for (int it = 0; it < 2; ++it)
+            {
+                double f = ((c3 * t + c2) * t + c1) * t + c0;
+                double d = (3.0 * c3 * t + 2.0 * c2) * t + c1;
+                if (fabs(d) > 1e-12)
+                    t -= f / d;
+            }
+
+            if (t >= -eps && t <= 1.0 + eps)
+                roots[count++] = float(min(1.0, max(0.0, t)));
+        }
+
+        return count;
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+void Intersection::CurveCurve(const Segment& a, const Segment& b, vector<Hit>& hits, float tol)
+{
+    if (Coincident(a, b, tol, hits))
+        return;
+
+    vector<Hit> raw;
+    uint budget = MaxLeaves;
+
+    Clip(a, b, { a, 0.0f, 1.0f }, { b, 0.0f, 1.0f }, 0, tol, raw, budget);
+
+    // folhas vizinhas convergem para o mesmo ponto e so agrupadas; o que
+    // ainda estiver afastado mais que tol no  uma interseo
+    auto gap = [&](const Hit& h) { return Distance(Bezier::Point(a, h.t), Bezier::Point(b, h.u)); };
+    size_t first = hits.size();
+    Merge(raw, hits, gap);
+
+    hits.erase(remove_if(hits.begin() + first, hits.end(), [&](const Hit& h) { return gap(h) > tol; }), hits.end());
+}
+
+// ------------------------------------------------------------------------------
+
+void Intersection::CurveLine(const Segment& a, const XMFLOAT3& p, const XMFLOAT3& q, vector<Hit>& hits, float tol)
+{
+    float lx = q.x - p.x;
+    float ly = q.y - p.y;
+    float len2 = lx * lx + ly * ly;
+
+    if (len2 <= 0.0f)
+        return;
+
+    float len = sqrt(len2);
+
+    // distncia com sinal e projeo dos pontos de controle na reta
+    double d[4], s[4];
+    bool onLine = true;
+    for (int i = 0; i < 4; ++i)
+    {
+        d[i] = Cross(lx, ly, a.P[i].x - p.x, a.P[i].y - p.y) / len;
+        s[i] = ((a.P[i].x - p.x) * lx + (a.P[i].y - p.y) * ly) / len2;
+        onLine = onLine && fabs(d[i]) <= tol;
+    }
+
+    // coeficientes na base de potncias de um polinmio de Bernstein
+    auto power = [](const double* w, double* c)
+    {
+        c[3] = -w[0] + 3.0 * w[1] - 3.0 * w[2] + w[3];
+        c[2] = 3.0 * w[0] - 6.0 * w[1] + 3.0 * w[2];
+        c[1] = -3.0 * w[0] + 3.0 * w[1];
+        c[0] = w[0];
+    };
+
+    auto along = [&](float t)
+    {
+        XMFLOAT3 pt = Bezier::Point(a, t);
+        return ((pt.x - p.x) * lx + (pt.y - p.y) * ly) / len2;
+    };
+
+    vector<Hit> raw;
+    float roots[3];
+    double c[4];
+
+    if (onLine)
+    {
+        // curva sobre a reta: trechos onde a projeo cai em [0,1],
+        // reportados como pares incio/fim com overlap = true
+        vector<float> cuts = { 0.0f, 1.0f };
+        for (double bound : { 0.0, 1.0 })
+        {
+            double w[4] = { s[0] - bound, s[1] - bound, s[2] - bound, s[3] - bound };
+            power(w, c);
+            uint n = SolveCubic(c[3], c[2], c[1], c[0], roots);
+            cuts.insert(cuts.end(), roots, roots + n);
+        }
+        sort(cuts.begin(), cuts.end());
+
+        for (size_t i = 0; i + 1 < cuts.size(); ++i)
+        {
+            float mid = 0.5f * (cuts[i] + cuts[i + 1]);
+            float u = along(mid);
+            if (cuts[i + 1] > cuts[i] && u >= 0.0f && u <= 1.0f)
+            {
+                hits.push_back({ cuts[i], min(1.0f, max(0.0f, along(cuts[i]))), true });
+                hits.push_back({ cuts[i + 1], min(1.0f, max(0.0f, along(cuts[i + 1]))), true });
+            }
+        }
+        return;
+    }
+
+    power(d, c);
+    uint n = SolveCubic(c[3], c[2], c[1], c[0], roots);
+    for (uint i = 0; i < n; ++i)
+        raw.push_back({ roots[i], along(roots[i]), false });
+
+    // tangncias: mnimos de |distncia| que encostam na reta sem cruz-la
+    n = SolveCubic(0.0, 3.0 * c[3], 2.0 * c[2], c[1], roots);
+    for (uint i = 0; i < n; ++i)
+    {
+        double t = roots[i];
+        double f = ((c[3] * t + c[2]) * t + c[1]) * t + c[0];
+        if (fabs(f) <= tol)
+            raw.push_back({ roots[i], along(roots[i]), false });
+    }
+
+    // descarta o que cai fora do segmento de reta
+    float slack = tol / len;
+    raw.erase(remove_if(raw.begin(), raw.end(),
+        [&](const Hit& h) { return h.u < -slack || h.u > 1.0f + slack; }), raw.end());
+
+    for (Hit& h : raw)
+        h.u = min(1.0f, max(0.0f, h.u));
+
+    auto gap = [&](const Hit& h)
+    {
+        XMFLOAT3 pt = Bezier::Point(a, h.t);
+        return float(fabs(Cross(lx, ly, pt.x - p.x, pt.y - p.y)) / len);
+    };
+    Merge(raw, hits, gap);
+}
+
+// ------------------------------------------------------------------------------
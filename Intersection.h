@@ -0,0 +1,132 @@
+/**********************************************************************************
+// Intersection (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Intersees curva-curva e curva-reta por subdiviso com
+//              recorte de caixas e fase ampla sobre uma BoxTree
+//
+**********************************************************************************/
+
+#ifndef _INTERSECTION_H_
+#define _INTERSECTION_H_
+
+#include "Bezier.h"
+#include "BoxTree.h"
+#include "Parallel.h"
+#include <vector>
+#include <algorithm>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Interseo entre dois objetos: t no primeiro, u no segundo.
+// Trechos sobrepostos (curvas quase coincidentes) geram um par de
+// intersees marcando incio e fim, ambas com overlap = true.
+struct Hit
+{
+    float t;
+    float u;
+    bool overlap;
+};
+
+// Interseo de uma curva de consulta com um segmento da cena
+struct Crossing
+{
+    uint segment;           // ndice do segmento na cena
+    Hit hit;                // t na consulta, u no segmento da cena
+    XMFLOAT3 point;
+};
+
+// ------------------------------------------------------------------------------
+
+namespace Intersection
+{
+    // tolerncia geomtrica padro (em coordenadas normalizadas da tela)
+    const float Tolerance = 1e-4f;
+
+    // todas as intersees entre duas curvas, ordenadas por t
+    void CurveCurve(const Segment& a, const Segment& b, vector<Hit>& hits, float tol = Tolerance);
+
+    // intersees entre uma curva e o segmento de reta p-q (u em [0,1] sobre a reta)
+    void CurveLine(const Segment& a, const XMFLOAT3& p, const XMFLOAT3& q, vector<Hit>& hits, float tol = Tolerance);
+
+    // intersees de uma curva com a cena, usando a rvore construda sobre Bezier::Bounds;
+    // a cena  qualquer coleo indexvel de segmentos (vetor, SegmentList)
+    template<class Scene>
+    void Query(const Segment& query, const Scene& scene, const BoxTree& tree,
+               vector<Crossing>& out, float tol = Tolerance);
+
+    // vrias consultas independentes distribudas entre os ncleos
+    template<class Scene>
+    void QueryBatch(const Segment* queries, uint count, const Scene& scene, const BoxTree& tree,
+                    vector<vector<Crossing>>& out, float tol = Tolerance);
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Scene>
+void Intersection::Query(const Segment& query, const Scene& scene, const BoxTree& tree,
+                         vector<Crossing>& out, float tol)
+{
+    // a consulta desce pela rvore subdividida ao meio enquanto for maior
+    // que o n visitado; partes menores que a tolerncia no se dividem mais
+    auto bound = [tol](const Segment& part)
+    {
+        Box box = Bezier::Hull(part);
+        box.minX -= tol; box.minY -= tol;
+        box.maxX += tol; box.maxY += tol;
+        return box;
+    };
+
+    auto split = [tol](const Segment& part, Segment& a, Segment& b)
+    {
+        Box box = Bezier::Hull(part);
+        if (box.maxX - box.minX <= 4 * tol && box.maxY - box.minY <= 4 * tol)
+            return false;
+
+        Bezier::Split(part, 0.5f, a, b);
+        return true;
+    };
+
+    // partes vizinhas podem encontrar o mesmo segmento
+    vector<uint> candidates;
+    tree.Query(query, bound, split, [&](uint i) { candidates.push_back(i); });
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    vector<Hit> hits;
+
+    for (uint i : candidates)
+    {
+        hits.clear();
+        CurveCurve(query, scene[i], hits, tol);
+
+        for (const Hit& h : hits)
+            out.push_back({ i, h, Bezier::Point(query, h.t) });
+    }
+
+    std::sort(out.begin(), out.end(), [](const Crossing& x, const Crossing& y) { return x.hit.t < y.hit.t; });
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Scene>
+void Intersection::QueryBatch(const Segment* queries, uint count, const Scene& scene, const BoxTree& tree,
+                              vector<vector<Crossing>>& out, float tol)
+{
+    out.resize(count);
+
+    ParallelFor(count, [&](uint i)
+    {
+        out[i].clear();
+        Query(queries[i], scene, tree, out[i], tol);
+    }, 16);
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
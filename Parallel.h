@@ -0,0 +1,61 @@
+/**********************************************************************************
+// Parallel (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Distribui um lao de ndices independentes entre os ncleos
+//
+**********************************************************************************/
+
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+// ------------------------------------------------------------------------------
+
+// Executa func(i) para i em [0, count), em blocos contguos por thread.
+// Lotes pequenos rodam na prpria thread chamadora.
+template<class Func>
+void ParallelFor(unsigned count, Func func, unsigned minPerThread = 64)
+{
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    unsigned threads = std::min(cores, (count + minPerThread - 1) / minPerThread);
+
+    if (threads <= 1)
+    {
+        for (unsigned i = 0; i < count; ++i)
+            func(i);
+        return;
+    }
+
+    unsigned block = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    for (unsigned k = 1; k < threads; ++k)
+    {
+        unsigned first = k * block;
+        unsigned last = std::min(count, first + block);
+        workers.emplace_back([=]() mutable
+        {
+            for (unsigned i = first; i < last; ++i)
+                func(i);
+        });
+    }
+
+    // primeiro bloco na thread chamadora
+    for (unsigned i = 0; i < std::min(count, block); ++i)
+        func(i);
+
+    for (auto& w : workers)
+        w.join();
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,159 @@
+/**********************************************************************************
+// Polyline (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Simplificao de polilinhas amostradas com erro limitado
+//              em pixels, em tempo linear e sem memria extra
+//
+**********************************************************************************/
+
+#ifndef _POLYLINE_H_
+#define _POLYLINE_H_
+
+#include "DXUT.h"
+#include <cmath>
+
+// ------------------------------------------------------------------------------
+
+namespace Polyline
+{
+    // contagem de vrtices antes e depois da simplificao
+    struct Reduction
+    {
+        uint input = 0;
+        uint output = 0;
+
+        // frao dos vrtices que foi removida
+        float Ratio() const { return input > 0 ? 1.0f - float(output) / float(input) : 0.0f; }
+    };
+
+    // Remove, no prprio vetor, os pontos que podem ser omitidos sem que a
+    // polilinha se afaste mais de error pixels da original; o primeiro e o
+    // ltimo ponto so sempre mantidos. scale converte as coordenadas em
+    // pixels e pos(point) devolve o XMFLOAT3 de um ponto, de modo que
+    // qualquer tipo de vrtice pode ser usado. Retorna a nova quantidade.
+    template<class Point, class Position>
+    uint Simplify(Point* points, uint count, XMFLOAT2 scale, float error, Position pos,
+                  Reduction* reduction = nullptr);
+}
+
+// ------------------------------------------------------------------------------
+
+namespace Polyline
+{
+    const float Pi = 3.14159265358979323846f;
+
+    // o ponto a (dx, dy) da ncora, a distncia d, est fora do setor [lo, hi]
+    // (medido a partir de base) ou mais perto da ncora que algum descartado
+    inline bool Outside(float dx, float dy, float d, float error, float base, float lo, float hi, float reach)
+    {
+        if (d < reach)
+            return true;
+
+        if (d <= error)
+            return false;
+
+        float angle = remainder(atan2(dy, dx) - base, 2.0f * Pi);
+        return angle < lo || angle > hi;
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+// Setor angular (Zhao-Saalfeld): a partir da ncora, cada ponto descartado
+// restringe as direes em que o prximo ponto mantido pode estar para que
+// a reta at ele passe a menos de error de todos os descartados. Quando um
+// ponto sai do setor (ou volta para trs), o anterior vira a nova ncora.
+// Os pontos mantidos so escritos sobre os j lidos, ento a compactao
+// acontece no prprio vetor.
+template<class Point, class Position>
+uint Polyline::Simplify(Point* points, uint count, XMFLOAT2 scale, float error, Position pos,
+                        Reduction* reduction)
+{
+    if (reduction)
+        reduction->input += count;
+
+    if (count <= 2)
+    {
+        if (reduction)
+            reduction->output += count;
+        return count;
+    }
+
+    uint out = 1;
+    float ax = pos(points[0]).x * scale.x;
+    float ay = pos(points[0]).y * scale.y;
+
+    bool open = false;          // j existe um setor a partir da ncora
+    float base = 0.0f;          // direo de referncia do setor
+    float lo = 0.0f, hi = 0.0f; // limites do setor em relao a base
+    float reach = 0.0f;         // maior distncia j aceita a partir da ncora
+
+    for (uint i = 1; i < count - 1; ++i)
+    {
+        float px = pos(points[i]).x * scale.x;
+        float py = pos(points[i]).y * scale.y;
+        float d = hypot(px - ax, py - ay);
+
+        // o ponto i no pode terminar o trecho: o anterior  mantido e vira ncora
+        if (open && Outside(px - ax, py - ay, d, error, base, lo, hi, reach))
+        {
+            points[out] = points[i - 1];
+            ax = pos(points[out]).x * scale.x;
+            ay = pos(points[out]).y * scale.y;
+            ++out;
+
+            open = false;
+            reach = 0.0f;
+            d = hypot(px - ax, py - ay);
+        }
+
+        reach = d > reach ? d : reach;
+
+        // pontos dentro do raio de erro da ncora no restringem direes
+        if (d <= error)
+            continue;
+
+        float direction = atan2(py - ay, px - ax);
+        float half = asin(error / d);
+
+        if (!open)
+        {
+            open = true;
+            base = direction;
+            lo = -half;
+            hi = half;
+        }
+        else
+        {
+            float rel = remainder(direction - base, 2.0f * Pi);
+            lo = rel - half > lo ? rel - half : lo;
+            hi = rel + half < hi ? rel + half : hi;
+        }
+    }
+
+    // o ltimo ponto s  aceito se estiver no setor; seno o anterior fica
+    if (open)
+    {
+        float px = pos(points[count - 1]).x * scale.x;
+        float py = pos(points[count - 1]).y * scale.y;
+        float d = hypot(px - ax, py - ay);
+
+        if (Outside(px - ax, py - ay, d, error, base, lo, hi, reach))
+            points[out++] = points[count - 2];
+    }
+
+    points[out++] = points[count - 1];
+
+    if (reduction)
+        reduction->output += out;
+
+    return out;
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,346 @@
+/**********************************************************************************
+// Projector (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Projeo de pontos sobre as curvas (ponto mais prximo),
+//              com tabela de amostras em cache e refinamento por Newton
+//
+**********************************************************************************/
+
+#include "Projector.h"
+#include <xmmintrin.h>
+#include <algorithm>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    const float Step = 1.0f / (Projector::Samples - 1);     // espaamento das amostras em t
+    const float Converged = 1e-7f;                          // passo de Newton desprezvel
+
+    // coeficientes na base de potncias: B(t) = ((a t + b) t + c) t + d
+    struct Cubic
+    {
+        float ax, bx, cx, dx;
+        float ay, by, cy, dy;
+    };
+
+    Cubic Coefficients(const Segment& s)
+    {
+        const XMFLOAT3* P = s.P;
+
+        return {
+            -P[0].x + 3.0f * P[1].x - 3.0f * P[2].x + P[3].x,
+            3.0f * P[0].x - 6.0f * P[1].x + 3.0f * P[2].x,
+            3.0f * (P[1].x - P[0].x),
+            P[0].x,
+            -P[0].y + 3.0f * P[1].y - 3.0f * P[2].y + P[3].y,
+            3.0f * P[0].y - 6.0f * P[1].y + 3.0f * P[2].y,
+            3.0f * (P[1].y - P[0].y),
+            P[0].y };
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+void Projector::Sample(const Segment& s, Table& table)
+{
+    table.reach = 0.0f;
+
+    for (uint k = 0; k < Samples; ++k)
+    {
+        XMFLOAT3 q = Bezier::Point(s, k * Step);
+        table.x[k] = q.x;
+        table.y[k] = q.y;
+
+        if (k > 0)
+            table.reach = max(table.reach, hypot(q.x - table.x[k - 1], q.y - table.y[k - 1]));
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+void Projector::Set(uint i, const Segment& s)
+{
+    if (i >= tables.size())
+        tables.resize(i + 1);
+
+    Sample(s, tables[i]);
+}
+
+// ------------------------------------------------------------------------------
+
+// Distncia ao quadrado de (px, py) at cada amostra, quatro por instruo
+void Projector::Distances(const Table& table, float px, float py, float* dist2)
+{
+    const __m128 vx = _mm_set1_ps(px);
+    const __m128 vy = _mm_set1_ps(py);
+
+    for (uint k = 0; k < Samples; k += 4)
+    {
+        __m128 dx = _mm_sub_ps(_mm_load_ps(table.x + k), vx);
+        __m128 dy = _mm_sub_ps(_mm_load_ps(table.y + k), vy);
+        _mm_store_ps(dist2 + k, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+// Newton sobre f(t) = (B(t) - p) . B'(t) a partir da amostra k. O mnimo
+// fica entre as amostras vizinhas; o sinal de f encolhe esse intervalo e
+// passos que saem dele (ou com f' <= 0) viram bisseco.
+Projection Projector::Refine(uint i, const Segment& s, const XMFLOAT3& p, uint k, float dist2)
+{
+    Cubic c = Coefficients(s);
+
+    float t  = k * Step;
+    float lo = k > 0 ? t - Step : 0.0f;
+    float hi = k < Samples - 1 ? t + Step : 1.0f;
+
+    for (uint it = 0; it < MaxNewton; ++it)
+    {
+        float ex = ((c.ax * t + c.bx) * t + c.cx) * t + c.dx - p.x;
+        float ey = ((c.ay * t + c.by) * t + c.cy) * t + c.dy - p.y;
+        float d1x = (3.0f * c.ax * t + 2.0f * c.bx) * t + c.cx;
+        float d1y = (3.0f * c.ay * t + 2.0f * c.by) * t + c.cy;
+        float d2x = 6.0f * c.ax * t + 2.0f * c.bx;
+        float d2y = 6.0f * c.ay * t + 2.0f * c.by;
+
+        float f  = ex * d1x + ey * d1y;
+        float df = d1x * d1x + d1y * d1y + ex * d2x + ey * d2y;
+
+        if (f < 0.0f)
+            lo = t;
+        else
+            hi = t;
+
+        float next = df > 0.0f ? t - f / df : 0.5f * (lo + hi);
+        if (!(next >= lo && next <= hi))
+            next = 0.5f * (lo + hi);
+
+        bool done = fabs(next - t) < Converged;
+        t = next;
+
+        if (done)
+            break;
+    }
+
+    float x = ((c.ax * t + c.bx) * t + c.cx) * t + c.dx;
+    float y = ((c.ay * t + c.by) * t + c.cy) * t + c.dy;
+    float d = (x - p.x) * (x - p.x) + (y - p.y) * (y - p.y);
+
+    // a amostra inicial prevalece se o refinamento no a superou
+    if (d > dist2)
+    {
+        t = k * Step;
+        x = ((c.ax * t + c.bx) * t + c.cx) * t + c.dx;
+        y = ((c.ay * t + c.by) * t + c.cy) * t + c.dy;
+        d = dist2;
+    }
+
+    return { i, t, sqrt(d), XMFLOAT3(x, y, 0.0f) };
+}
+
+// ------------------------------------------------------------------------------
+
+// A distncia ao quadrado tem no mximo trs mnimos locais; cada mnimo
+// das amostras  refinado, pois o mais prximo nem sempre est no vale
+// da amostra mais prxima
+bool Projector::Closest(uint i, const Segment& s, const XMFLOAT3& p, float limit, Projection& out) const
+{
+    const Table& table = tables[i];
+    alignas(16) float dist2[Samples];
+    Distances(table, p.x, p.y, dist2);
+
+    // descarta o segmento se nem a amostra mais prxima, descontado
+    // o espaamento entre amostras, pode ficar dentro do limite
+    float nearest = *min_element(dist2, dist2 + Samples);
+    if (sqrt(nearest) - table.reach > limit)
+        return false;
+
+    bool found = false;
+
+    for (uint k = 0; k < Samples; ++k)
+    {
+        bool minimum = (k == 0 || dist2[k] <= dist2[k - 1]) && (k == Samples - 1 || dist2[k] <= dist2[k + 1]);
+        if (!minimum || sqrt(dist2[k]) - table.reach > limit)
+            continue;
+
+        Projection candidate = Refine(i, s, p, k, dist2[k]);
+        if (!found || candidate.distance < out.distance)
+        {
+            out = candidate;
+            found = true;
+            limit = min(limit, candidate.distance);
+        }
+    }
+
+    return found;
+}
+
+// ------------------------------------------------------------------------------
+
+Projection Projector::Project(uint i, const Segment& s, const XMFLOAT3& p) const
+{
+    Projection out = { i, 0.0f, FLT_MAX, p };
+    Closest(i, s, p, FLT_MAX, out);
+    return out;
+}
+
+// ------------------------------------------------------------------------------
+
+// Mesmo algoritmo de Closest e Refine com um ponto por faixa: as distncias
+// s amostras e as iteraes de Newton avanam juntas para quatro pontos.
+// Com nmero fixo de sementes, cada faixa refina a amostra mais prxima e
+// o melhor mnimo local fora do vale dela.
+void Projector::ProjectBatch(const Segment& s, uint index, const XMFLOAT3* points, uint count, Projection* out)
+{
+    if (count == 0)
+        return;
+
+    Table table;
+    Sample(s, table);
+    Cubic c = Coefficients(s);
+
+    const __m128 ax = _mm_set1_ps(c.ax), bx = _mm_set1_ps(c.bx), cx = _mm_set1_ps(c.cx), dx = _mm_set1_ps(c.dx);
+    const __m128 ay = _mm_set1_ps(c.ay), by = _mm_set1_ps(c.by), cy = _mm_set1_ps(c.cy), dy = _mm_set1_ps(c.dy);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 three = _mm_set1_ps(3.0f);
+    const __m128 six = _mm_set1_ps(6.0f);
+    const __m128 step = _mm_set1_ps(Step);
+    const __m128 far = _mm_set1_ps(1.5f * Step);
+
+    auto select = [](__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); };
+
+    auto px = _mm_setzero_ps();
+    auto py = _mm_setzero_ps();
+
+    auto evaluate = [&](__m128 t, __m128& x, __m128& y)
+    {
+        x = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ax, t), bx), t), cx), t), dx);
+        y = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(ay, t), by), t), cy), t), dy);
+    };
+
+    // Newton protegido a partir da semente t, com o mesmo nmero de
+    // iteraes em todas as faixas; retorna a distncia ao quadrado
+    auto refine = [&](__m128& t) -> __m128
+    {
+        __m128 lo = _mm_max_ps(zero, _mm_sub_ps(t, step));
+        __m128 hi = _mm_min_ps(one, _mm_add_ps(t, step));
+        __m128 ex, ey;
+
+        for (uint it = 0; it < MaxNewton; ++it)
+        {
+            evaluate(t, ex, ey);
+            ex = _mm_sub_ps(ex, px);
+            ey = _mm_sub_ps(ey, py);
+
+            __m128 d1x = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(three, ax), t), _mm_mul_ps(two, bx)), t), cx);
+            __m128 d1y = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(three, ay), t), _mm_mul_ps(two, by)), t), cy);
+            __m128 d2x = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(six, ax), t), _mm_mul_ps(two, bx));
+            __m128 d2y = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(six, ay), t), _mm_mul_ps(two, by));
+
+            __m128 f  = _mm_add_ps(_mm_mul_ps(ex, d1x), _mm_mul_ps(ey, d1y));
+            __m128 df = _mm_add_ps(_mm_add_ps(_mm_mul_ps(d1x, d1x), _mm_mul_ps(d1y, d1y)),
+                                   _mm_add_ps(_mm_mul_ps(ex, d2x), _mm_mul_ps(ey, d2y)));
+
+            __m128 below = _mm_cmplt_ps(f, zero);
+            lo = select(below, t, lo);
+            hi = select(below, hi, t);
+
+            // passos invlidos (NaN, f' <= 0 ou fora do intervalo) viram bisseco
+            __m128 next = _mm_sub_ps(t, _mm_div_ps(f, df));
+            __m128 valid = _mm_and_ps(_mm_cmpgt_ps(df, zero),
+                           _mm_and_ps(_mm_cmpge_ps(next, lo), _mm_cmple_ps(next, hi)));
+            t = select(valid, next, _mm_mul_ps(half, _mm_add_ps(lo, hi)));
+        }
+
+        evaluate(t, ex, ey);
+        ex = _mm_sub_ps(ex, px);
+        ey = _mm_sub_ps(ey, py);
+        return _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+    };
+
+    for (uint first = 0; first < count; first += 4)
+    {
+        // o ltimo grupo repete o ltimo ponto nas faixas que sobram
+        const XMFLOAT3& p0 = points[first];
+        const XMFLOAT3& p1 = points[min(first + 1, count - 1)];
+        const XMFLOAT3& p2 = points[min(first + 2, count - 1)];
+        const XMFLOAT3& p3 = points[min(first + 3, count - 1)];
+
+        px = _mm_set_ps(p3.x, p2.x, p1.x, p0.x);
+        py = _mm_set_ps(p3.y, p2.y, p1.y, p0.y);
+
+        // distncias s amostras e amostra mais prxima de cada ponto
+        __m128 dist[Samples];
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128 seed = zero;
+
+        for (uint k = 0; k < Samples; ++k)
+        {
+            __m128 ex = _mm_sub_ps(_mm_set1_ps(table.x[k]), px);
+            __m128 ey = _mm_sub_ps(_mm_set1_ps(table.y[k]), py);
+            dist[k] = _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+
+            __m128 closer = _mm_cmplt_ps(dist[k], best);
+            best = _mm_min_ps(dist[k], best);
+            seed = select(closer, _mm_set1_ps(k * Step), seed);
+        }
+
+        // melhor mnimo local a mais de uma amostra de distncia da primeira semente
+        __m128 other = _mm_set1_ps(FLT_MAX);
+        __m128 second = seed;
+
+        for (uint k = 0; k < Samples; ++k)
+        {
+            __m128 tk = _mm_set1_ps(k * Step);
+            __m128 gap = _mm_max_ps(_mm_sub_ps(tk, seed), _mm_sub_ps(seed, tk));
+            __m128 mask = _mm_and_ps(_mm_cmpgt_ps(gap, far), _mm_cmplt_ps(dist[k], other));
+
+            if (k > 0)
+                mask = _mm_and_ps(mask, _mm_cmple_ps(dist[k], dist[k - 1]));
+            if (k < Samples - 1)
+                mask = _mm_and_ps(mask, _mm_cmple_ps(dist[k], dist[k + 1]));
+
+            other = select(mask, dist[k], other);
+            second = select(mask, tk, second);
+        }
+
+        __m128 t = seed;
+        __m128 d = refine(t);
+
+        // a amostra inicial prevalece se o refinamento no a superou
+        __m128 worse = _mm_cmpgt_ps(d, best);
+        t = select(worse, seed, t);
+        d = select(worse, best, d);
+
+        __m128 u = second;
+        __m128 e = refine(u);
+        __m128 closer = _mm_cmplt_ps(e, d);
+        t = select(closer, u, t);
+        d = select(closer, e, d);
+
+        __m128 x, y;
+        evaluate(t, x, y);
+        d = _mm_sqrt_ps(d);
+
+        alignas(16) float rt[4], rd[4], rx[4], ry[4];
+        _mm_store_ps(rt, t);
+        _mm_store_ps(rd, d);
+        _mm_store_ps(rx, x);
+        _mm_store_ps(ry, y);
+
+        for (uint j = 0; j < 4 && first + j < count; ++j)
+            out[first + j] = { index, rt[j], rd[j], XMFLOAT3(rx[j], ry[j], 0.0f) };
+    }
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,153 @@
+/**********************************************************************************
+// Projector (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Projeo de pontos sobre as curvas (ponto mais prximo),
+//              com tabela de amostras em cache e refinamento por Newton
+//
+**********************************************************************************/
+
+#ifndef _PROJECTOR_H_
+#define _PROJECTOR_H_
+
+#include "Bezier.h"
+#include "BoxTree.h"
+#include "Parallel.h"
+#include <vector>
+#include <cmath>
+#include <cfloat>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Ponto mais prximo de uma consulta sobre a cena. Numa spline que comea
+// no segmento first, o parmetro global  (segment - first) + t.
+struct Projection
+{
+    uint segment;
+    float t;
+    float distance;
+    XMFLOAT3 point;
+};
+
+// ------------------------------------------------------------------------------
+
+// Guarda, para cada segmento da cena, uma tabela de amostras uniformes em t.
+// A consulta mede a distncia at as amostras (SSE, 4 por instruo) e
+// refina cada mnimo local com Newton protegido por um intervalo que
+// encolhe a cada passo.
+class Projector
+{
+public:
+    static const uint Samples = 16;         // amostras por segmento
+    static const uint MaxNewton = 8;        // iteraes de refinamento
+
+private:
+    struct alignas(16) Table
+    {
+        float x[Samples];
+        float y[Samples];
+        float reach;                        // maior distncia entre amostras vizinhas
+    };
+
+    vector<Table> tables;
+
+    static void Sample(const Segment& s, Table& table);
+    static void Distances(const Table& table, float px, float py, float* dist2);
+    static Projection Refine(uint i, const Segment& s, const XMFLOAT3& p, uint k, float dist2);
+
+    // projeo sobre o segmento i, se ele puder estar a no mximo limit de p
+    bool Closest(uint i, const Segment& s, const XMFLOAT3& p, float limit, Projection& out) const;
+
+public:
+    // mantm a tabela do segmento i (a tabela cresce se preciso)
+    void Set(uint i, const Segment& s);
+    void Resize(uint count) { tables.resize(count); }
+    void Clear() { tables.clear(); }
+    uint Size() const { return uint(tables.size()); }
+
+    // projeo de p sobre o segmento i, cuja tabela j est em cache
+    Projection Project(uint i, const Segment& s, const XMFLOAT3& p) const;
+
+    // segmento mais prximo de p a no mximo radius, usando a rvore
+    // construda sobre Bezier::Bounds; retorna false se nenhum estiver ao alcance
+    template<class Scene>
+    bool Nearest(const Scene& scene, const BoxTree& tree, const XMFLOAT3& p,
+                 float radius, Projection& out) const;
+
+    // ponto mais prximo de p sobre a spline formada pelos segmentos [first, first + count)
+    template<class Scene>
+    Projection Spline(const Scene& scene, uint first, uint count, const XMFLOAT3& p) const;
+
+    // vrias consultas Nearest distribudas entre os ncleos; found[i] indica o resultado
+    template<class Scene>
+    void NearestBatch(const Scene& scene, const BoxTree& tree, const XMFLOAT3* points, uint count,
+                      float radius, Projection* out, bool* found) const;
+
+    // projeta muitos pontos sobre um nico segmento, quatro por vez (SSE),
+    // sem depender da tabela em cache
+    static void ProjectBatch(const Segment& s, uint index, const XMFLOAT3* points, uint count, Projection* out);
+};
+
+// ------------------------------------------------------------------------------
+
+template<class Scene>
+bool Projector::Nearest(const Scene& scene, const BoxTree& tree, const XMFLOAT3& p,
+                        float radius, Projection& out) const
+{
+    Box region = { p.x - radius, p.y - radius, p.x + radius, p.y + radius };
+    float best = radius;
+    bool found = false;
+
+    tree.Query(region, [&](uint i)
+    {
+        Projection candidate;
+        if (Closest(i, scene[i], p, best, candidate) && candidate.distance <= best)
+        {
+            best = candidate.distance;
+            out = candidate;
+            found = true;
+
+            // s segmentos que podem estar mais perto continuam na busca
+            region = { p.x - best, p.y - best, p.x + best, p.y + best };
+        }
+    });
+
+    return found;
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Scene>
+Projection Projector::Spline(const Scene& scene, uint first, uint count, const XMFLOAT3& p) const
+{
+    Projection out = { first, 0.0f, FLT_MAX, p };
+
+    for (uint i = first; i < first + count; ++i)
+    {
+        Projection candidate;
+        if (Closest(i, scene[i], p, out.distance, candidate) && candidate.distance < out.distance)
+            out = candidate;
+    }
+
+    return out;
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Scene>
+void Projector::NearestBatch(const Scene& scene, const BoxTree& tree, const XMFLOAT3* points, uint count,
+                             float radius, Projection* out, bool* found) const
+{
+    ParallelFor(count, [&](uint i)
+    {
+        found[i] = Nearest(scene, tree, points[i], radius, out[i]);
+    }, 256);
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
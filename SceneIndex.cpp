@@ -0,0 +1,55 @@
+/**********************************************************************************
+// SceneIndex (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Estruturas de consulta derivadas dos segmentos da cena
+//              (caixas, tabelas de projeo, splines e hierarquias)
+//
+**********************************************************************************/
+
+#include "SceneIndex.h"
+#include "Parallel.h"
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+void SceneIndex::Build(const SegmentList& scene)
+{
+    uint count = scene.Size();
+
+    bounds.resize(count);
+    projector.Resize(count);
+
+    // cada segmento escreve s a sua caixa e a sua tabela
+    ParallelFor(count, [&](uint i)
+    {
+        bounds[i] = Bezier::Bounds(scene[i]);
+        projector.Set(i, scene[i]);
+    }, 1024);
+
+    splines.clear();
+    for (uint i = 0; i < count; ++i)
+    {
+        if (i == 0 || scene[i - 1].P[3].x != scene[i].P[0].x || scene[i - 1].P[3].y != scene[i].P[0].y)
+            splines.push_back(i);
+    }
+
+    tree.Build(bounds.data(), count);
+    splineTree.Build(bounds.data(), count, splines);
+}
+
+// ------------------------------------------------------------------------------
+
+void SceneIndex::Clear()
+{
+    bounds.clear();
+    splines.clear();
+    tree.Clear();
+    splineTree.Clear();
+    projector.Clear();
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,43 @@
+/**********************************************************************************
+// SceneIndex (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Estruturas de consulta derivadas dos segmentos da cena
+//              (caixas, tabelas de projeo, splines e hierarquias)
+//
+**********************************************************************************/
+
+#ifndef _SCENEINDEX_H_
+#define _SCENEINDEX_H_
+
+#include "SegmentList.h"
+#include "BoxTree.h"
+#include "SplineTree.h"
+#include "Projector.h"
+#include <vector>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Tudo o que pode ser recalculado a partir de uma verso da cena. Montar o
+// ndice no depende da interface, de modo que uma leitura em segundo plano
+// o entrega pronto e a troca pelo ndice em uso custa s alguns ponteiros.
+struct SceneIndex
+{
+    vector<Box> bounds;             // caixas exatas dos segmentos
+    vector<uint> splines;           // primeiro segmento de cada spline
+    BoxTree tree;                   // segmentos da cena
+    SplineTree splineTree;          // splines e seus segmentos, para o desenho
+    Projector projector;
+
+    // reconstri tudo para os segmentos de scene
+    void Build(const SegmentList& scene);
+    void Clear();
+};
+
+// ------------------------------------------------------------------------------
+
+#endif
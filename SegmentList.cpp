@@ -0,0 +1,109 @@
+/**********************************************************************************
+// SegmentList (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Lista persistente de segmentos: cada edio gera uma nova
+//              verso imutvel que compartilha com as anteriores todos os
+//              blocos que no mudaram (rvore de prefixos com cpia do
+//              caminho alterado)
+//
+**********************************************************************************/
+
+#include "SegmentList.h"
+#include <algorithm>
+using std::make_shared;
+using std::copy;
+
+// ------------------------------------------------------------------------------
+
+const Segment& SegmentList::operator[](uint i) const
+{
+    const void* node = root.get();
+
+    for (uint level = shift; level > 0; level -= Bits)
+        node = static_cast<const Branch*>(node)->child[(i >> level) & (Width - 1)].get();
+
+    return static_cast<const Leaf*>(node)->items[i & (Width - 1)];
+}
+
+// ------------------------------------------------------------------------------
+
+// Grava items[0..n-1] a partir do ndice i (todos no mesmo bloco),
+// copiando apenas os ns do caminho at ele; o resto  compartilhado
+SegmentList::Ref SegmentList::Assign(const Ref& node, uint shift, uint i, const Segment* items, uint n)
+{
+    if (shift == 0)
+    {
+        auto leaf = node ? make_shared<Leaf>(*static_cast<const Leaf*>(node.get())) : make_shared<Leaf>();
+        copy(items, items + n, leaf->items + (i & (Width - 1)));
+        return leaf;
+    }
+
+    auto branch = node ? make_shared<Branch>(*static_cast<const Branch*>(node.get())) : make_shared<Branch>();
+    Ref& child = branch->child[(i >> shift) & (Width - 1)];
+    child = Assign(child, shift - Bits, i, items, n);
+    return branch;
+}
+
+// ------------------------------------------------------------------------------
+
+SegmentList SegmentList::Set(uint i, const Segment& s) const
+{
+    SegmentList list = *this;
+    list.root = Assign(root, shift, i, &s, 1);
+    return list;
+}
+
+// ------------------------------------------------------------------------------
+
+SegmentList SegmentList::PushBack(const Segment& s) const
+{
+    return Append(&s, 1);
+}
+
+// ------------------------------------------------------------------------------
+
+SegmentList SegmentList::Append(const Segment* items, uint n) const
+{
+    SegmentList list = *this;
+
+    while (n > 0)
+    {
+        // rvore cheia: a raiz atual vira o primeiro filho de uma nova raiz
+        if (list.root && (unsigned long long)list.count >= ((unsigned long long)Width << list.shift))
+        {
+            auto branch = make_shared<Branch>();
+            branch->child[0] = list.root;
+            list.root = branch;
+            list.shift += Bits;
+        }
+
+        uint offset = list.count & (Width - 1);
+        uint take = n < Width - offset ? n : Width - offset;
+
+        list.root = Assign(list.root, list.shift, list.count, items, take);
+        list.count += take;
+        items += take;
+        n -= take;
+    }
+
+    return list;
+}
+
+// ------------------------------------------------------------------------------
+
+SegmentList SegmentList::PopBack() const
+{
+    // os ns continuam compartilhados; s o tamanho visvel diminui
+    SegmentList list = *this;
+    if (list.count > 0)
+        --list.count;
+    if (list.count == 0)
+        list = SegmentList();
+    return list;
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+/**********************************************************************************
+// SegmentList (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Lista persistente de segmentos: cada edio gera uma nova
+//              verso imutvel que compartilha com as anteriores todos os
+//              blocos que no mudaram (rvore de prefixos com cpia do
+//              caminho alterado)
+//
+**********************************************************************************/
+
+#ifndef _SEGMENTLIST_H_
+#define _SEGMENTLIST_H_
+
+#include "Bezier.h"
+#include <memory>
+using std::shared_ptr;
+
+// ------------------------------------------------------------------------------
+
+class SegmentList
+{
+public:
+    static const uint Bits = 5;
+    static const uint Width = 1 << Bits;        // segmentos por bloco e filhos por n
+
+private:
+    typedef shared_ptr<const void> Ref;
+
+    struct Leaf   { Segment items[Width]; };
+    struct Branch { Ref child[Width]; };
+
+    Ref  root;
+    uint count = 0;
+    uint shift = 0;                             // 0: a raiz  uma folha
+
+    static Ref Assign(const Ref& node, uint shift, uint i, const Segment* items, uint n);
+
+    template<class Visit>
+    static void Diff(const void* now, const void* old, uint shift, uint oldShift,
+                     uint base, uint count, uint oldCount, Visit& visit);
+
+public:
+    uint Size() const { return count; }
+    bool Empty() const { return count == 0; }
+
+    const Segment& operator[](uint i) const;
+
+    // novas verses; a lista original no  alterada
+    SegmentList Set(uint i, const Segment& s) const;
+    SegmentList PushBack(const Segment& s) const;
+    SegmentList PopBack() const;
+
+    // acrescenta n segmentos de uma vez, preenchendo blocos inteiros
+    SegmentList Append(const Segment* items, uint n) const;
+
+    // chama visit(items, first, n) para cada bloco contguo, em ordem
+    template<class Visit>
+    void ForEachBlock(Visit visit) const;
+
+    // chama visit(first, n) para cada bloco desta verso que no 
+    // compartilhado com old (blocos iguais so pulados sem visitar os filhos)
+    template<class Visit>
+    void Changed(const SegmentList& old, Visit visit) const;
+};
+
+// ------------------------------------------------------------------------------
+
+template<class Visit>
+void SegmentList::ForEachBlock(Visit visit) const
+{
+    for (uint first = 0; first < count; first += Width)
+    {
+        const Segment* items = &(*this)[first];
+        uint n = count - first < Width ? count - first : Width;
+        visit(items, first, n);
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Visit>
+void SegmentList::Diff(const void* now, const void* old, uint shift, uint oldShift,
+                       uint base, uint count, uint oldCount, Visit& visit)
+{
+    if (base >= count)
+        return;
+
+    // n compartilhado s vale at o tamanho que a verso antiga enxergava
+    unsigned long long end = base + ((unsigned long long)Width << shift);
+    if (now == old && end <= oldCount)
+        return;
+
+    if (shift == 0)
+    {
+        visit(base, count - base < Width ? count - base : Width);
+        return;
+    }
+
+    const Branch* b = static_cast<const Branch*>(now);
+
+    // a verso antiga  mais rasa: ela corresponde ao primeiro filho
+    const Branch* o = (old && shift == oldShift) ? static_cast<const Branch*>(old) : nullptr;
+    bool deeper = old && shift > oldShift;
+
+    for (uint c = 0; c < Width; ++c)
+    {
+        const void* oc = o ? o->child[c].get() : (deeper && c == 0 ? old : nullptr);
+        uint os = deeper && c == 0 ? oldShift : shift - Bits;
+        Diff(b->child[c].get(), oc, shift - Bits, os, base + (c << shift), count, oldCount, visit);
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+template<class Visit>
+void SegmentList::Changed(const SegmentList& old, Visit visit) const
+{
+    // verso antiga mais funda: a atual cabe no ramo mais  esquerda dela,
+    // que  comparado no lugar da raiz antiga
+    const void* o = old.root.get();
+    uint oldShift = old.shift;
+
+    while (o && oldShift > shift)
+    {
+        o = static_cast<const Branch*>(o)->child[0].get();
+        oldShift -= Bits;
+    }
+
+    Diff(root.get(), o, shift, oldShift, 0, count, old.count, visit);
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
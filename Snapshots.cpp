@@ -0,0 +1,98 @@
+/**********************************************************************************
+// Snapshots (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Publicao de verses imutveis da cena para leitores em
+//              outras threads, com liberao por pocas (estilo RCU)
+//
+**********************************************************************************/
+
+#include "Snapshots.h"
+#include <algorithm>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+Snapshots::Snapshots()
+{
+    current.store(new Snapshot{ SegmentList(), version });
+}
+
+// ------------------------------------------------------------------------------
+
+Snapshots::~Snapshots()
+{
+    // nenhum leitor pode estar ativo neste ponto
+    for (const Retired& r : retired)
+        delete r.snapshot;
+
+    delete current.load();
+}
+
+// ------------------------------------------------------------------------------
+
+void Snapshots::Publish(const SegmentList& segments)
+{
+    const Snapshot* old = current.exchange(new Snapshot{ segments, ++version });
+
+    // leitores que anunciarem pocas posteriores j enxergam a nova verso
+    retired.push_back({ old, epoch.fetch_add(1) });
+
+    Reclaim();
+}
+
+// ------------------------------------------------------------------------------
+
+// Libera as verses que nenhum leitor ativo pode estar lendo
+void Snapshots::Reclaim()
+{
+    unsigned long long oldest = ~0ull;
+
+    for (const Slot& slot : readers)
+    {
+        unsigned long long e = slot.epoch.load();
+        if (e != 0)
+            oldest = min(oldest, e);
+    }
+
+    auto freed = remove_if(retired.begin(), retired.end(), [oldest](const Retired& r)
+    {
+        if (r.epoch >= oldest)
+            return false;
+
+        delete r.snapshot;
+        return true;
+    });
+
+    retired.erase(freed, retired.end());
+}
+
+// ------------------------------------------------------------------------------
+
+uint Snapshots::Register()
+{
+    for (uint i = 0; i < MaxReaders; ++i)
+    {
+        bool expected = false;
+        if (readers[i].used.compare_exchange_strong(expected, true))
+            return i;
+    }
+
+    return MaxReaders;
+}
+
+// ------------------------------------------------------------------------------
+
+void Snapshots::Unregister(uint reader)
+{
+    if (reader < MaxReaders)
+    {
+        readers[reader].epoch.store(0);
+        readers[reader].used.store(false);
+    }
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,105 @@
+/**********************************************************************************
+// Snapshots (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Publicao de verses imutveis da cena para leitores em
+//              outras threads, com liberao por pocas (estilo RCU)
+//
+**********************************************************************************/
+
+#ifndef _SNAPSHOTS_H_
+#define _SNAPSHOTS_H_
+
+#include "SegmentList.h"
+#include <atomic>
+#include <vector>
+using std::atomic;
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// Verso da cena vista pelos leitores
+struct Snapshot
+{
+    SegmentList segments;
+    unsigned long long version;
+};
+
+// ------------------------------------------------------------------------------
+
+// Um nico escritor publica verses; qualquer nmero de leitores (at
+// MaxReaders registrados) l a mais recente sem travas. O escritor nunca
+// espera: verses substitudas ficam aposentadas at que nenhum leitor
+// ativo possa estar com elas e so liberadas nas publicaes seguintes.
+class Snapshots
+{
+public:
+    static const uint MaxReaders = 16;
+
+private:
+    // poca anunciada por cada leitor (0 = fora de leitura), uma por linha de cache
+    struct alignas(64) Slot
+    {
+        atomic<unsigned long long> epoch { 0 };
+        atomic<bool> used { false };
+    };
+
+    struct Retired
+    {
+        const Snapshot* snapshot;
+        unsigned long long epoch;
+    };
+
+    Slot readers[MaxReaders];
+    atomic<unsigned long long> epoch { 1 };
+    atomic<const Snapshot*> current { nullptr };
+    unsigned long long version = 0;
+    vector<Retired> retired;                    // acessado s pelo escritor
+
+    void Reclaim();
+
+public:
+    Snapshots();
+    ~Snapshots();
+
+    // escritor: publica uma nova verso da cena
+    void Publish(const SegmentList& segments);
+
+    // leitores: reservam um lugar (retorna MaxReaders se no houver)
+    uint Register();
+    void Unregister(uint reader);
+
+    // chama read(const Snapshot&) com a verso mais recente; a verso
+    // permanece vlida at read retornar (copiar segments a mantm depois).
+    // Retorna false, sem ler, se reader no foi obtido por Register.
+    template<class Reader>
+    bool Read(uint reader, Reader read);
+
+    // nmero de verses aguardando liberao
+    size_t Pending() const { return retired.size(); }
+};
+
+// ------------------------------------------------------------------------------
+
+template<class Reader>
+bool Snapshots::Read(uint reader, Reader read)
+{
+    if (reader >= MaxReaders)
+        return false;
+
+    Slot& slot = readers[reader];
+
+    // anuncia a poca antes de ler o ponteiro: o escritor no libera
+    // nada que tenha sido substitudo a partir desta poca
+    slot.epoch.store(epoch.load());
+    read(*current.load());
+    slot.epoch.store(0, std::memory_order_release);
+    return true;
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
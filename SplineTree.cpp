@@ -0,0 +1,154 @@
+/**********************************************************************************
+// SplineTree (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Hierarquia de caixas em dois nveis (cena e spline) para
+//              selecionar os trechos de curva visveis numa janela
+//
+**********************************************************************************/
+
+#include "SplineTree.h"
+#include <algorithm>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+void SplineTree::BuildSpline(Spline& spline, const Box* bounds)
+{
+    const Box* first = bounds + spline.first;
+
+    spline.box = first[0];
+    for (uint i = 1; i < spline.count; ++i)
+        spline.box = Bezier::Merge(spline.box, first[i]);
+
+    spline.tree.Build(first, spline.count);
+}
+
+// ------------------------------------------------------------------------------
+
+void SplineTree::BuildTop()
+{
+    boxes.resize(splines.size());
+    for (size_t k = 0; k < splines.size(); ++k)
+        boxes[k] = splines[k].box;
+
+    tree.Build(boxes.data(), uint(boxes.size()));
+}
+
+// ------------------------------------------------------------------------------
+
+void SplineTree::Build(const Box* bounds, uint count, const vector<uint>& starts)
+{
+    splines.clear();
+
+    for (size_t k = 0; k < starts.size(); ++k)
+    {
+        uint first = starts[k];
+        uint last = k + 1 < starts.size() ? starts[k + 1] : count;
+
+        if (last <= first)
+            continue;
+
+        Spline spline;
+        spline.first = first;
+        spline.count = last - first;
+        BuildSpline(spline, bounds);
+        splines.push_back(move(spline));
+    }
+
+    BuildTop();
+}
+
+// ------------------------------------------------------------------------------
+
+void SplineTree::Append(const Box* bounds, uint count, const vector<uint>& starts)
+{
+    auto next = starts.begin();
+
+    // a ltima spline cresce at o incio da prxima
+    if (!splines.empty())
+    {
+        next = upper_bound(starts.begin(), starts.end(), splines.back().first);
+        Extend(uint(splines.size() - 1), bounds, next != starts.end() ? *next : count);
+    }
+
+    // segmentos soltos: a cena ganha splines novas
+    for (; next != starts.end(); ++next)
+    {
+        uint end = next + 1 != starts.end() ? *(next + 1) : count;
+        if (end <= *next)
+            continue;
+
+        Spline spline;
+        spline.first = *next;
+        spline.count = 0;
+        spline.box = bounds[*next];
+        splines.push_back(move(spline));
+
+        Extend(uint(splines.size() - 1), bounds, end);
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+// Insere na spline k os segmentos at end e troca a sua caixa no nvel de cima
+void SplineTree::Extend(uint k, const Box* bounds, uint end)
+{
+    Spline& spline = splines[k];
+
+    if (spline.first + spline.count >= end)
+        return;
+
+    for (uint i = spline.first + spline.count; i < end; ++i)
+    {
+        spline.tree.Insert(i - spline.first, bounds[i]);
+        spline.box = Bezier::Merge(spline.box, bounds[i]);
+    }
+
+    spline.count = end - spline.first;
+
+    if (k < boxes.size())
+        tree.Remove(k);
+    else
+        boxes.resize(k + 1);
+
+    boxes[k] = spline.box;
+    tree.Insert(k, spline.box);
+}
+
+// ------------------------------------------------------------------------------
+
+void SplineTree::Truncate(uint count)
+{
+    while (!splines.empty() && splines.back().first >= count)
+    {
+        tree.Remove(uint(splines.size() - 1));
+        splines.pop_back();
+    }
+
+    boxes.resize(splines.size());
+
+    if (splines.empty())
+        return;
+
+    Spline& spline = splines.back();
+
+    for (uint i = count - spline.first; i < spline.count; ++i)
+        spline.tree.Remove(i);
+
+    spline.count = min(spline.count, count - spline.first);
+}
+
+// ------------------------------------------------------------------------------
+
+void SplineTree::Clear()
+{
+    splines.clear();
+    boxes.clear();
+    tree.Clear();
+}
+
+// ------------------------------------------------------------------------------
@@ -0,0 +1,102 @@
+/**********************************************************************************
+// SplineTree (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Hierarquia de caixas em dois nveis (cena e spline) para
+//              selecionar os trechos de curva visveis numa janela
+//
+**********************************************************************************/
+
+#ifndef _SPLINETREE_H_
+#define _SPLINETREE_H_
+
+#include "BoxTree.h"
+#include <vector>
+#include <algorithm>
+using std::vector;
+
+// ------------------------------------------------------------------------------
+
+// A cena  uma sequncia de splines, cada uma uma faixa contnua de
+// segmentos. O nvel de cima organiza as caixas das splines; cada spline
+// tem sua prpria rvore sobre as caixas dos segmentos.
+class SplineTree
+{
+private:
+    struct Spline
+    {
+        uint first;             // primeiro segmento
+        uint count;             // quantidade de segmentos
+        Box box;                // unio das caixas dos segmentos
+        BoxTree tree;           // ndices relativos a first
+    };
+
+    vector<Spline> splines;
+    vector<Box> boxes;          // caixas das splines, para o nvel de cima
+    BoxTree tree;
+
+    void BuildSpline(Spline& spline, const Box* bounds);
+    void BuildTop();
+    void Extend(uint k, const Box* bounds, uint end);
+
+public:
+    // bounds: caixa de cada segmento; starts: primeiro segmento de cada spline
+    void Build(const Box* bounds, uint count, const vector<uint>& starts);
+
+    // acrescenta os segmentos novos do fim da cena sem refazer as rvores:
+    // eles so inseridos na ltima spline ou nas splines que comeam depois
+    void Append(const Box* bounds, uint count, const vector<uint>& starts);
+
+    // descarta os segmentos a partir de count; as caixas que restam
+    // continuam valendo, apenas maiores que o necessrio
+    void Truncate(uint count);
+
+    void Clear();
+
+    // chama visit(first, n) para cada faixa contnua de segmentos cujas
+    // caixas tocam view; splines inteiramente dentro de view no so descidas
+    template<class Visit>
+    void Visible(const Box& view, Visit visit) const;
+};
+
+// ------------------------------------------------------------------------------
+
+template<class Visit>
+void SplineTree::Visible(const Box& view, Visit visit) const
+{
+    vector<uint> visible;
+
+    tree.Query(view, [&](uint k)
+    {
+        const Spline& spline = splines[k];
+
+        if (Bezier::Contains(view, spline.box))
+        {
+            visit(spline.first, spline.count);
+            return;
+        }
+
+        visible.clear();
+        spline.tree.Query(view, [&](uint i) { visible.push_back(i); });
+        std::sort(visible.begin(), visible.end());
+
+        // segmentos consecutivos formam uma nica faixa
+        size_t i = 0;
+        while (i < visible.size())
+        {
+            size_t j = i + 1;
+            while (j < visible.size() && visible[j] == visible[j - 1] + 1)
+                ++j;
+
+            visit(spline.first + visible[i], uint(j - i));
+            i = j;
+        }
+    });
+}
+
+// ------------------------------------------------------------------------------
+
+#endif
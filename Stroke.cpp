@@ -0,0 +1,274 @@
+/**********************************************************************************
+// Stroke (Cdigo Fonte)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Expanso de polilinhas em faixas de tringulos com
+//              espessura, junes e terminaes
+//
+**********************************************************************************/
+
+#include "Stroke.h"
+#include <xmmintrin.h>
+#include <cmath>
+#include <algorithm>
+using namespace std;
+
+// ------------------------------------------------------------------------------
+
+namespace
+{
+    const float Pi = 3.14159265358979323846f;
+    const float Degenerate = 1e-6f;         // trechos mais curtos (em pixels) no tm direo
+    const float Straight = 0.9999f;         // cosseno acima do qual a juno  reta
+
+    // escreve posies de volta em coordenadas normalizadas, a cada stride bytes
+    struct Writer
+    {
+        XMFLOAT3* out;
+        uint stride;
+        float sx, sy;
+        uint count;
+
+        void Put(float x, float y)
+        {
+            XMFLOAT3* v = reinterpret_cast<XMFLOAT3*>(reinterpret_cast<char*>(out) + size_t(count) * stride);
+            *v = XMFLOAT3(x / sx, y / sy, 0.0f);
+            ++count;
+        }
+
+        // par de vrtices  esquerda e  direita de (cx, cy)
+        void Pair(float cx, float cy, float ox, float oy)
+        {
+            Put(cx + ox, cy + oy);
+            Put(cx - ox, cy - oy);
+        }
+    };
+
+    // -------------------------------------------------------------------------
+
+    // normal  esquerda do trecho a-b, se ele tiver comprimento
+    bool Normal(float ax, float ay, float bx, float by, float& nx, float& ny)
+    {
+        float dx = bx - ax;
+        float dy = by - ay;
+        float len = sqrt(dx * dx + dy * dy);
+
+        if (len < Degenerate)
+            return false;
+
+        nx = -dy / len;
+        ny = dx / len;
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Juno no ponto p entre trechos de normais n0 e n1 (unitrias)
+    void Corner(Writer& w, const Stroke::Style& style, float hw, float px, float py,
+                float n0x, float n0y, float n1x, float n1y)
+    {
+        float c = n0x * n1x + n0y * n1y;
+
+        // esquina de esquadria: deslocamento (n0 + n1) hw / (1 + n0.n1),
+        // cujo comprimento em larguras  sqrt(2 / (1 + c))
+        bool miter = c >= Straight || (style.join == Stroke::MiterJoin && (1.0f + c) * style.miterLimit * style.miterLimit >= 2.0f);
+
+        if (miter)
+        {
+            float k = hw / (1.0f + c);
+            w.Pair(px, py, (n0x + n1x) * k, (n0y + n1y) * k);
+            return;
+        }
+
+        if (style.join != Stroke::RoundJoin)
+        {
+            w.Pair(px, py, n0x * hw, n0y * hw);
+            w.Pair(px, py, n1x * hw, n1y * hw);
+            return;
+        }
+
+        // arco de n0 at n1 no sentido da curva
+        float angle = acos(max(-1.0f, min(1.0f, c)));
+        if (n0x * n1y - n0y * n1x < 0.0f)
+            angle = -angle;
+
+        uint steps = max(1u, uint(ceil(fabs(angle) * Stroke::RoundSteps / Pi)));
+        steps = min(steps, Stroke::RoundSteps);
+
+        for (uint k = 0; k <= steps; ++k)
+        {
+            float a = angle * k / steps;
+            float ca = cos(a), sa = sin(a);
+            w.Pair(px, py, (n0x * ca - n0y * sa) * hw, (n0x * sa + n0y * ca) * hw);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+
+    // Terminao no ponto p do trecho de normal n; start indica o incio da polilinha
+    void EndCap(Writer& w, const Stroke::Style& style, float hw, float px, float py, float nx, float ny, bool start)
+    {
+        // direo para fora do trao: a normal  a direo girada 90 graus
+        float ex = start ? -ny : ny;
+        float ey = start ? nx : -nx;
+
+        switch (style.cap)
+        {
+        case Stroke::ButtCap:
+            w.Pair(px, py, nx * hw, ny * hw);
+            break;
+
+        case Stroke::SquareCap:
+            w.Pair(px + ex * hw, py + ey * hw, nx * hw, ny * hw);
+            break;
+
+        case Stroke::RoundCap:
+        {
+            // meia circunferncia em pares simtricos, da ponta at a largura total
+            const uint steps = Stroke::RoundSteps / 2;
+            for (uint i = 0; i <= steps; ++i)
+            {
+                uint k = start ? i : steps - i;
+                float a = 0.5f * Pi * k / steps;
+                float along = cos(a) * hw;
+                float across = sin(a) * hw;
+                w.Pair(px + ex * along, py + ey * along, nx * across, ny * across);
+            }
+            break;
+        }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------
+
+uint Stroke::Capacity(uint count, const Style& style)
+{
+    if (count < 2)
+        return 0;
+
+    uint joinPairs = style.join == RoundJoin ? RoundSteps + 1 : 2;
+    uint capPairs = style.cap == RoundCap ? RoundSteps / 2 + 1 : 1;
+
+    return 2 * (2 * capPairs + (count - 2) * joinPairs);
+}
+
+// ------------------------------------------------------------------------------
+
+// As junes so calculadas quatro por vez (SSE): normais dos trechos vizinhos
+// e deslocamento de esquadria. Onde a esquadria basta, o par sai direto;
+// arredondados, chanfros e trechos degenerados seguem o caminho escalar.
+uint Stroke::Expand(const float* x, const float* y, uint count, const Style& style, XMFLOAT2 scale,
+                    XMFLOAT3* out, uint stride)
+{
+    if (count < 2)
+        return 0;
+
+    Writer w = { out, stride, scale.x, scale.y, 0 };
+    const float hw = 0.5f * style.width;
+    const float sx = scale.x;
+    const float sy = scale.y;
+
+    // normal do primeiro trecho com comprimento (sem nenhum, no h trao)
+    float px = 0.0f, py = 0.0f;
+    uint first = 0;
+    while (first + 1 < count && !Normal(x[first] * sx, y[first] * sy, x[first + 1] * sx, y[first + 1] * sy, px, py))
+        ++first;
+
+    if (first + 1 == count)
+        return 0;
+
+    EndCap(w, style, hw, x[0] * sx, y[0] * sy, px, py, true);
+
+    // ltima normal vlida, usada onde o trecho anterior  degenerado
+    float prevX = px, prevY = py;
+
+    // juno escalar do vrtice i
+    auto joint = [&](uint i)
+    {
+        float ax = x[i - 1] * sx, ay = y[i - 1] * sy;
+        float bx = x[i] * sx,     by = y[i] * sy;
+        float cx = x[i + 1] * sx, cy = y[i + 1] * sy;
+
+        float n0x, n0y, n1x, n1y;
+        if (!Normal(bx, by, cx, cy, n1x, n1y))
+            return;
+
+        if (!Normal(ax, ay, bx, by, n0x, n0y))
+        {
+            n0x = prevX;
+            n0y = prevY;
+        }
+
+        Corner(w, style, hw, bx, by, n0x, n0y, n1x, n1y);
+        prevX = n1x;
+        prevY = n1y;
+    };
+
+    const __m128 vsx = _mm_set1_ps(sx);
+    const __m128 vsy = _mm_set1_ps(sy);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minimum = _mm_set1_ps(Degenerate);
+    const __m128 straight = _mm_set1_ps(Straight);
+    const __m128 miterCut = _mm_set1_ps(style.join == MiterJoin ? 2.0f / (style.miterLimit * style.miterLimit) : 2.0f);
+    const __m128 vhw = _mm_set1_ps(hw);
+
+    uint i = 1;
+    for (; i + 4 < count; i += 4)
+    {
+        __m128 ax = _mm_mul_ps(_mm_loadu_ps(x + i - 1), vsx), ay = _mm_mul_ps(_mm_loadu_ps(y + i - 1), vsy);
+        __m128 bx = _mm_mul_ps(_mm_loadu_ps(x + i), vsx),     by = _mm_mul_ps(_mm_loadu_ps(y + i), vsy);
+        __m128 cx = _mm_mul_ps(_mm_loadu_ps(x + i + 1), vsx), cy = _mm_mul_ps(_mm_loadu_ps(y + i + 1), vsy);
+
+        __m128 d0x = _mm_sub_ps(bx, ax), d0y = _mm_sub_ps(by, ay);
+        __m128 d1x = _mm_sub_ps(cx, bx), d1y = _mm_sub_ps(cy, by);
+        __m128 len0 = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(d0x, d0x), _mm_mul_ps(d0y, d0y)));
+        __m128 len1 = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(d1x, d1x), _mm_mul_ps(d1y, d1y)));
+
+        // trechos degenerados geram NaN aqui, mas ficam fora da mscara
+        __m128 n0x = _mm_div_ps(_mm_sub_ps(_mm_setzero_ps(), d0y), len0), n0y = _mm_div_ps(d0x, len0);
+        __m128 n1x = _mm_div_ps(_mm_sub_ps(_mm_setzero_ps(), d1y), len1), n1y = _mm_div_ps(d1x, len1);
+        __m128 c = _mm_add_ps(_mm_mul_ps(n0x, n1x), _mm_mul_ps(n0y, n1y));
+        __m128 k = _mm_div_ps(vhw, _mm_add_ps(one, c));
+        __m128 ox = _mm_mul_ps(_mm_add_ps(n0x, n1x), k);
+        __m128 oy = _mm_mul_ps(_mm_add_ps(n0y, n1y), k);
+
+        __m128 valid = _mm_and_ps(_mm_cmpge_ps(len0, minimum), _mm_cmpge_ps(len1, minimum));
+        __m128 flat = _mm_or_ps(_mm_cmpge_ps(c, straight), _mm_cmpge_ps(_mm_add_ps(one, c), miterCut));
+        int fast = _mm_movemask_ps(_mm_and_ps(valid, flat));
+
+        alignas(16) float rbx[4], rby[4], rox[4], roy[4], rnx[4], rny[4];
+        _mm_store_ps(rbx, bx);
+        _mm_store_ps(rby, by);
+        _mm_store_ps(rox, ox);
+        _mm_store_ps(roy, oy);
+        _mm_store_ps(rnx, n1x);
+        _mm_store_ps(rny, n1y);
+
+        for (uint j = 0; j < 4; ++j)
+        {
+            if (fast & (1 << j))
+            {
+                w.Pair(rbx[j], rby[j], rox[j], roy[j]);
+                prevX = rnx[j];
+                prevY = rny[j];
+            }
+            else
+            {
+                joint(i + j);
+            }
+        }
+    }
+
+    for (; i + 1 < count; ++i)
+        joint(i);
+
+    EndCap(w, style, hw, x[count - 1] * sx, y[count - 1] * sy, prevX, prevY, false);
+
+    return w.count;
+}
+
+// ------------------------------------------------------------------------------
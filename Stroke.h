@@ -0,0 +1,51 @@
+/**********************************************************************************
+// Stroke (Arquivo de Cabealho)
+//
+// Criao:     19 Out 2026
+// Atualizao: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrio:   Expanso de polilinhas em faixas de tringulos com
+//              espessura, junes e terminaes
+//
+**********************************************************************************/
+
+#ifndef _STROKE_H_
+#define _STROKE_H_
+
+#include "DXUT.h"
+
+// ------------------------------------------------------------------------------
+
+namespace Stroke
+{
+    enum Join { MiterJoin, RoundJoin, BevelJoin };
+    enum Cap  { ButtCap, SquareCap, RoundCap };
+
+    // passos de um arco de meia volta nas junes e terminaes arredondadas
+    const uint RoundSteps = 8;
+
+    struct Style
+    {
+        float width = 3.0f;             // espessura em pixels
+        Join join = MiterJoin;
+        Cap cap = ButtCap;
+        float miterLimit = 4.0f;        // acima disso (em larguras) a juno vira chanfro
+    };
+
+    // vrtices necessrios, no pior caso, para expandir uma polilinha de count pontos
+    uint Capacity(uint count, const Style& style);
+
+    // Expande a polilinha (x, y em coordenadas normalizadas) numa triangle
+    // strip: pares de vrtices  esquerda e  direita do trao. scale
+    // converte as coordenadas em pixels, e a espessura  medida na tela.
+    // Cada posio  escrita em out a cada stride bytes, direto no buffer de
+    // vrtices; o restante de cada vrtice no  tocado. Retorna a
+    // quantidade escrita (no mximo Capacity).
+    uint Expand(const float* x, const float* y, uint count, const Style& style, XMFLOAT2 scale,
+                XMFLOAT3* out, uint stride);
+}
+
+// ------------------------------------------------------------------------------
+
+#endif